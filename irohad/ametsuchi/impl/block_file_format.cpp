@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_file_format.hpp"
+
+#include <limits>
+
+#include <boost/crc.hpp>
+#include <boost/format.hpp>
+
+#include "backend/protobuf/block.hpp"
+#include "common/byteutils.hpp"
+
+namespace {
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  // header field offsets
+  constexpr size_t kMagicOffset = 0;
+  constexpr size_t kVersionOffset = 4;
+  constexpr size_t kSizeOffset = 8;
+  constexpr size_t kCrcOffset = 12;
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr uint32_t BlockFileFormat::kMagic;
+    constexpr uint16_t BlockFileFormat::kVersion;
+    constexpr size_t BlockFileFormat::kHeaderSize;
+
+    BlockFileFormat::BlockFileFormat(
+        std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
+            legacy_converter)
+        : legacy_converter_(std::move(legacy_converter)) {}
+
+    expected::Result<BlockFileFormat::Bytes, std::string>
+    BlockFileFormat::serialize(
+        const shared_model::interface::Block &block) const {
+      iroha::protocol::Block proto_block;
+      *proto_block.mutable_block_v1() =
+          static_cast<const shared_model::proto::Block &>(block)
+              .getTransport();
+
+      const auto payload_size = proto_block.ByteSizeLong();
+      if (payload_size > std::numeric_limits<uint32_t>::max()) {
+        return expected::makeError(
+            (boost::format("Block %d is too large: %d bytes") % block.height()
+             % payload_size)
+                .str());
+      }
+
+      Bytes record(kHeaderSize + payload_size);
+      auto payload = record.data() + kHeaderSize;
+      if (not proto_block.SerializeToArray(payload, payload_size)) {
+        return expected::makeError(
+            (boost::format("Failed to serialize block %d") % block.height())
+                .str());
+      }
+
+      writeLittleEndian<uint32_t>(record.data() + kMagicOffset, kMagic);
+      writeLittleEndian<uint16_t>(record.data() + kVersionOffset, kVersion);
+      writeLittleEndian<uint32_t>(record.data() + kSizeOffset,
+                                  static_cast<uint32_t>(payload_size));
+      writeLittleEndian<uint32_t>(record.data() + kCrcOffset,
+                                  checksum(payload, payload_size));
+      return expected::makeValue(std::move(record));
+    }
+
+    BlockFileFormat::BlockResult BlockFileFormat::deserialize(
+        const uint8_t *data, size_t size) const {
+      if (not isBinary(data, size)) {
+        return legacy_converter_->deserialize(
+            std::string(reinterpret_cast<const char *>(data), size));
+      }
+
+      const auto version = readLittleEndian<uint16_t>(data + kVersionOffset);
+      if (version != kVersion) {
+        return expected::makeError(
+            (boost::format("Unsupported block format version %d") % version)
+                .str());
+      }
+
+      const auto payload_size =
+          readLittleEndian<uint32_t>(data + kSizeOffset);
+      if (payload_size != size - kHeaderSize) {
+        return expected::makeError(
+            (boost::format("Block record size mismatch: expected %d, got %d")
+             % payload_size % (size - kHeaderSize))
+                .str());
+      }
+
+      const auto payload = data + kHeaderSize;
+      if (checksum(payload, payload_size)
+          != readLittleEndian<uint32_t>(data + kCrcOffset)) {
+        return expected::makeError(std::string("Block checksum mismatch"));
+      }
+
+      iroha::protocol::Block proto_block;
+      if (not proto_block.ParseFromArray(payload, payload_size)) {
+        return expected::makeError(std::string("Failed to parse block"));
+      }
+
+      std::unique_ptr<shared_model::interface::Block> result =
+          std::make_unique<shared_model::proto::Block>(
+              std::move(*proto_block.mutable_block_v1()));
+      return expected::makeValue(std::move(result));
+    }
+
+    BlockFileFormat::BlockResult BlockFileFormat::deserialize(
+        const Bytes &record) const {
+      return deserialize(record.data(), record.size());
+    }
+
+    bool BlockFileFormat::isBinary(const uint8_t *data, size_t size) {
+      return size >= kHeaderSize
+          and readLittleEndian<uint32_t>(data + kMagicOffset) == kMagic;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_FILE_FORMAT_HPP
+#define IROHA_BLOCK_FILE_FORMAT_HPP
+
+#include <memory>
+
+#include "ametsuchi/key_value_storage.hpp"
+#include "common/result.hpp"
+#include "interfaces/iroha_internal/block_json_deserializer.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Versioned binary representation of blocks in the block store.
+     *
+     * Each record is a fixed-size header followed by the serialized
+     * iroha::protocol::Block message. All header fields are little-endian:
+     * | magic (4) | version (2) | reserved (2) | payload size (4) | crc32 (4) |
+     *
+     * Records which do not start with the magic are treated as blocks in the
+     * legacy JSON format and are parsed with the provided json deserializer,
+     * so ledgers written by older versions remain readable.
+     */
+    class BlockFileFormat {
+     public:
+      using Bytes = KeyValueStorage::Bytes;
+      using BlockResult =
+          expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                           std::string>;
+
+      /// "IRBK" read as a little-endian integer
+      static constexpr uint32_t kMagic = 0x4B425249;
+      static constexpr uint16_t kVersion = 1;
+      static constexpr size_t kHeaderSize = 16;
+
+      /**
+       * @param legacy_converter - deserializer for blocks stored as json
+       */
+      explicit BlockFileFormat(
+          std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
+              legacy_converter);
+
+      /**
+       * Serialize block into a binary record
+       * @param block - block to serialize
+       * @return header and serialized protobuf block or an error
+       */
+      expected::Result<Bytes, std::string> serialize(
+          const shared_model::interface::Block &block) const;
+
+      /**
+       * Parse a record produced either by serialize() or by the legacy json
+       * block store
+       * @param data - pointer to the beginning of the record
+       * @param size - size of the record
+       * @return deserialized block or an error
+       */
+      BlockResult deserialize(const uint8_t *data, size_t size) const;
+
+      BlockResult deserialize(const Bytes &record) const;
+
+      /**
+       * @return true if the record starts with the binary format header
+       */
+      static bool isBinary(const uint8_t *data, size_t size);
+
+     private:
+      std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
+          legacy_converter_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_FILE_FORMAT_HPP
@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/cached_wsv_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using shared_model::interface::types::AccountDetailKeyType;
+    using shared_model::interface::types::AccountIdType;
+    using shared_model::interface::types::AssetIdType;
+    using shared_model::interface::types::DomainIdType;
+    using shared_model::interface::types::PubkeyType;
+    using shared_model::interface::types::RoleIdType;
+
+    CachedWsvQuery::CachedWsvQuery(std::shared_ptr<WsvQuery> wsv_query,
+                                   std::shared_ptr<WsvCache> cache)
+        : wsv_query_(std::move(wsv_query)), cache_(std::move(cache)) {}
+
+    boost::optional<std::vector<RoleIdType>> CachedWsvQuery::getAccountRoles(
+        const AccountIdType &account_id) {
+      return cache_->getAccountRoles(account_id, [&] {
+        return wsv_query_->getAccountRoles(account_id);
+      });
+    }
+
+    boost::optional<shared_model::interface::RolePermissionSet>
+    CachedWsvQuery::getRolePermissions(const RoleIdType &role_name) {
+      return cache_->getRolePermissions(role_name, [&] {
+        return wsv_query_->getRolePermissions(role_name);
+      });
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Account>>
+    CachedWsvQuery::getAccount(const AccountIdType &account_id) {
+      return cache_->getAccount(
+          account_id, [&] { return wsv_query_->getAccount(account_id); });
+    }
+
+    boost::optional<std::string> CachedWsvQuery::getAccountDetail(
+        const AccountIdType &account_id,
+        const AccountDetailKeyType &key,
+        const AccountIdType &writer) {
+      return wsv_query_->getAccountDetail(account_id, key, writer);
+    }
+
+    boost::optional<std::vector<PubkeyType>> CachedWsvQuery::getSignatories(
+        const AccountIdType &account_id) {
+      return cache_->getSignatories(
+          account_id, [&] { return wsv_query_->getSignatories(account_id); });
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Asset>>
+    CachedWsvQuery::getAsset(const AssetIdType &asset_id) {
+      return wsv_query_->getAsset(asset_id);
+    }
+
+    boost::optional<
+        std::vector<std::shared_ptr<shared_model::interface::AccountAsset>>>
+    CachedWsvQuery::getAccountAssets(const AccountIdType &account_id) {
+      return wsv_query_->getAccountAssets(account_id);
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::AccountAsset>>
+    CachedWsvQuery::getAccountAsset(const AccountIdType &account_id,
+                                    const AssetIdType &asset_id) {
+      return wsv_query_->getAccountAsset(account_id, asset_id);
+    }
+
+    boost::optional<std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+    CachedWsvQuery::getPeers() {
+      return wsv_query_->getPeers();
+    }
+
+    boost::optional<std::vector<RoleIdType>> CachedWsvQuery::getRoles() {
+      return wsv_query_->getRoles();
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Domain>>
+    CachedWsvQuery::getDomain(const DomainIdType &domain_id) {
+      return wsv_query_->getDomain(domain_id);
+    }
+
+    bool CachedWsvQuery::hasAccountGrantablePermission(
+        const AccountIdType &permitee_account_id,
+        const AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission) {
+      return wsv_query_->hasAccountGrantablePermission(
+          permitee_account_id, account_id, permission);
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHED_WSV_QUERY_HPP
+#define IROHA_CACHED_WSV_QUERY_HPP
+
+#include "ametsuchi/wsv_query.hpp"
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * WsvQuery which serves accounts, signatories, account roles and role
+     * permissions from the cache and forwards everything else to the wrapped
+     * query. Wrapped query must read committed state only.
+     */
+    class CachedWsvQuery : public WsvQuery {
+     public:
+      CachedWsvQuery(std::shared_ptr<WsvQuery> wsv_query,
+                     std::shared_ptr<WsvCache> cache);
+
+      boost::optional<std::vector<shared_model::interface::types::RoleIdType>>
+      getAccountRoles(const shared_model::interface::types::AccountIdType
+                          &account_id) override;
+
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getRolePermissions(
+          const shared_model::interface::types::RoleIdType &role_name) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Account>>
+      getAccount(const shared_model::interface::types::AccountIdType
+                     &account_id) override;
+
+      boost::optional<std::string> getAccountDetail(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AccountDetailKeyType &key = "",
+          const shared_model::interface::types::AccountIdType &writer =
+              "") override;
+
+      boost::optional<std::vector<shared_model::interface::types::PubkeyType>>
+      getSignatories(const shared_model::interface::types::AccountIdType
+                         &account_id) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Asset>> getAsset(
+          const shared_model::interface::types::AssetIdType &asset_id) override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::AccountAsset>>>
+      getAccountAssets(const shared_model::interface::types::AccountIdType
+                           &account_id) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::AccountAsset>>
+      getAccountAsset(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id) override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+      getPeers() override;
+
+      boost::optional<std::vector<shared_model::interface::types::RoleIdType>>
+      getRoles() override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Domain>>
+      getDomain(const shared_model::interface::types::DomainIdType &domain_id)
+          override;
+
+      bool hasAccountGrantablePermission(
+          const shared_model::interface::types::AccountIdType
+              &permitee_account_id,
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::permissions::Grantable permission) override;
+
+     private:
+      std::shared_ptr<WsvQuery> wsv_query_;
+      std::shared_ptr<WsvCache> cache_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHED_WSV_QUERY_HPP
@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <ciso646>
 #include <iomanip>
 #include <iostream>
@@ -13,6 +16,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/algorithm/find_if.hpp>
+#include "ametsuchi/impl/mapped_bytes_view.hpp"
 #include "common/files.hpp"
 
 using namespace iroha::ametsuchi;
@@ -95,6 +99,27 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
   return buf;
 }
 
+boost::optional<std::unique_ptr<FlatFile::BytesView>> FlatFile::getView(
+    Identifier id) const {
+  const auto filename =
+      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
+  auto fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    log_->info("getView({}) file not found", id);
+    return boost::none;
+  }
+  struct stat st;
+  auto view = ::fstat(fd, &st) == 0
+      ? MappedBytesView::create(fd, 0, static_cast<size_t>(st.st_size))
+      : boost::none;
+  // mapping stays valid after the descriptor is closed
+  ::close(fd);
+  if (not view) {
+    log_->info("getView({}) problem with mapping file", id);
+  }
+  return view;
+}
+
 std::string FlatFile::directory() const {
   return dump_dir_;
 }
@@ -57,6 +57,9 @@ namespace iroha {
 
       boost::optional<Bytes> get(Identifier id) const override;
 
+      boost::optional<std::unique_ptr<BytesView>> getView(
+          Identifier id) const override;
+
       std::string directory() const override;
 
       Identifier last_id() const override;
@@ -0,0 +1,548 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_balance_executor.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/format.hpp>
+#include "ametsuchi/impl/soci_utils.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "utils/string_builder.hpp"
+
+namespace {
+  using Role = shared_model::interface::permissions::Role;
+  using PrecisionType = shared_model::interface::types::PrecisionType;
+  using Balance = boost::multiprecision::uint256_t;
+  /// wide enough to check limits and overflows of balances
+  using Wide = boost::multiprecision::uint512_t;
+
+  const std::string kSelectPermissions =
+      (boost::format(R"(
+SELECT CAST(COALESCE(bit_or(rp.permission), '0'::bit(%1%)) AS text)
+FROM account AS a
+LEFT JOIN account_has_roles AS ar ON ar.account_id = a.account_id
+LEFT JOIN role_has_permissions AS rp ON rp.role_id = ar.role_id
+WHERE a.account_id = :account_id
+GROUP BY a.account_id)")
+       % shared_model::interface::RolePermissionSet::size())
+          .str();
+
+  const std::string kSelectPrecision =
+      "SELECT precision FROM asset WHERE asset_id = :asset_id";
+
+  const std::string kSelectBalance = R"(
+SELECT CAST(amount AS text) FROM account_has_asset
+WHERE account_id = :account_id AND asset_id = :asset_id)";
+
+  // add net changes of balances, rows are created for accounts which had no
+  // balance of the asset
+  const std::string kWriteBalances = R"(
+INSERT INTO account_has_asset(account_id, asset_id, amount)
+SELECT * FROM unnest(CAST(:accounts AS text[]),
+                     CAST(:assets AS text[]),
+                     CAST(:deltas AS decimal[]))
+ON CONFLICT (account_id, asset_id)
+DO UPDATE SET amount = account_has_asset.amount + EXCLUDED.amount)";
+
+  Wide pow10(PrecisionType exponent) {
+    return boost::multiprecision::pow(Wide(10), exponent);
+  }
+
+  /**
+   * Upper bound of a balance in units of the asset precision, the same as
+   * checked by the postgres executor for the amount of the given precision
+   */
+  Wide limit(PrecisionType amount_precision, PrecisionType asset_precision) {
+    return (Wide(1) << (256 - amount_precision)) * pow10(asset_precision);
+  }
+
+  boost::optional<Balance> toBalance(const Wide &value) {
+    if (value > Wide(std::numeric_limits<Balance>::max())) {
+      return boost::none;
+    }
+    return Balance(value);
+  }
+
+  /**
+   * Convert decimal value to units of the given precision
+   * @return value and its scale, none if value is not representable
+   */
+  boost::optional<std::pair<Balance, PrecisionType>> parseDecimal(
+      const std::string &value, PrecisionType precision) {
+    auto dot = value.find('.');
+    auto digits = value;
+    size_t scale = 0;
+    if (dot != std::string::npos) {
+      digits.erase(dot, 1);
+      scale = value.size() - dot - 1;
+    }
+    if (digits.empty() or scale > precision
+        or digits.find_first_not_of("0123456789") != std::string::npos) {
+      return boost::none;
+    }
+    // leading zero would be parsed as octal prefix
+    digits.erase(0,
+                 std::min(digits.find_first_not_of('0'), digits.size() - 1));
+    auto balance = toBalance(Wide(digits) * pow10(precision - scale));
+    if (not balance) {
+      return boost::none;
+    }
+    return std::make_pair(*balance, static_cast<PrecisionType>(scale));
+  }
+
+  /**
+   * Format difference between balances as a decimal of the given scale
+   */
+  std::string formatDelta(const Balance &from,
+                          const Balance &to,
+                          PrecisionType precision,
+                          PrecisionType scale) {
+    std::string sign = to < from ? "-" : "";
+    Balance delta = to < from ? from - to : to - from;
+    auto digits = (Wide(delta) / pow10(precision - scale)).str();
+    if (scale == 0) {
+      return sign + digits;
+    }
+    if (digits.size() <= scale) {
+      digits.insert(0, scale + 1 - digits.size(), '0');
+    }
+    digits.insert(digits.size() - scale, ".");
+    return sign + digits;
+  }
+
+  std::string domainOf(const std::string &id, char separator) {
+    auto pos = id.find(separator);
+    return pos == std::string::npos ? "" : id.substr(pos + 1);
+  }
+
+  iroha::ametsuchi::CommandResult makeCommandError(std::string command_name,
+                                                   uint32_t code,
+                                                   std::string query_args) {
+    return iroha::expected::makeError(iroha::ametsuchi::CommandError{
+        std::move(command_name), code, std::move(query_args)});
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    InMemoryBalanceExecutor::InMemoryBalanceExecutor(
+        soci::session &sql,
+        std::unique_ptr<CommandExecutor> executor,
+        std::unordered_set<shared_model::interface::types::AssetIdType>
+            hot_assets,
+        logger::Logger log)
+        : sql_(sql),
+          executor_(std::move(executor)),
+          hot_assets_(std::move(hot_assets)),
+          do_validation_(true),
+          log_(std::move(log)) {}
+
+    void InMemoryBalanceExecutor::setCreatorAccountId(
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      creator_account_id_ = creator_account_id;
+      executor_->setCreatorAccountId(creator_account_id);
+    }
+
+    void InMemoryBalanceExecutor::doValidation(bool do_validation) {
+      do_validation_ = do_validation;
+      executor_->doValidation(do_validation);
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::AddAssetQuantity &command) {
+      const auto &account_id = creator_account_id_;
+      const auto &asset_id = command.assetId();
+      if (hot_assets_.count(asset_id) == 0) {
+        return delegate(command, {{account_id, asset_id}});
+      }
+      auto amount = command.amount().toStringRepr();
+      auto amount_precision = command.amount().precision();
+      auto error = [&](CommandError::ErrorCodeType code) {
+        return makeCommandError(
+            "AddAssetQuantity",
+            code,
+            shared_model::detail::PrettyStringBuilder()
+                .init("Query arguments")
+                .append("account_id", account_id)
+                .append("asset_id", asset_id)
+                .append("amount", amount)
+                .append("precision", std::to_string(amount_precision))
+                .finalize());
+      };
+
+      try {
+        const auto &account = permissions(account_id);
+        if (do_validation_) {
+          auto has_perm = account
+              and (account->test(Role::kAddAssetQty)
+                   or (domainOf(account_id, '@') == domainOf(asset_id, '#')
+                       and account->test(Role::kAddDomainAssetQty)));
+          if (not has_perm) {
+            return error(2);
+          }
+        }
+        const auto asset_precision = precision(asset_id);
+        if (not asset_precision or *asset_precision < amount_precision) {
+          return error(3);
+        }
+        auto units = toBalance(Wide(command.amount().intValue())
+                               * pow10(*asset_precision - amount_precision));
+        auto current = entry({account_id, asset_id}, *asset_precision);
+        if (not units or not current) {
+          return delegate(command, {{account_id, asset_id}});
+        }
+        Wide value = Wide(current->current) + Wide(*units);
+        if (value >= limit(amount_precision, *asset_precision)) {
+          return error(4);
+        }
+        if (not account) {
+          return error(1);
+        }
+        auto new_value = toBalance(value);
+        if (not new_value) {
+          return delegate(command, {{account_id, asset_id}});
+        }
+
+        Entry updated = *current;
+        updated.current = *new_value;
+        updated.scale = std::max(updated.scale, amount_precision);
+        update({account_id, asset_id}, updated);
+        return {};
+      } catch (const std::exception &e) {
+        log_->error("AddAssetQuantity failed: {}", e.what());
+        return error(1);
+      }
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::AddPeer &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::AddSignatory &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::AppendRole &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::CreateAccount &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::CreateAsset &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::CreateDomain &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::CreateRole &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::DetachRole &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::GrantPermission &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::RemoveSignatory &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::RevokePermission &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::SetAccountDetail &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::SetQuorum &command) {
+      return delegate(command, {});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::SubtractAssetQuantity &command) {
+      return delegate(command, {{creator_account_id_, command.assetId()}});
+    }
+
+    CommandResult InMemoryBalanceExecutor::operator()(
+        const shared_model::interface::TransferAsset &command) {
+      const auto &src_account_id = command.srcAccountId();
+      const auto &dest_account_id = command.destAccountId();
+      const auto &asset_id = command.assetId();
+      std::vector<BalanceKey> touched{{src_account_id, asset_id},
+                                      {dest_account_id, asset_id}};
+      // transfers on behalf of other accounts require grantable permissions,
+      // which are checked by the wrapped executor
+      if (hot_assets_.count(asset_id) == 0
+          or src_account_id == dest_account_id
+          or (do_validation_ and src_account_id != creator_account_id_)) {
+        return delegate(command, touched);
+      }
+      auto amount = command.amount().toStringRepr();
+      auto amount_precision = command.amount().precision();
+      auto error = [&](CommandError::ErrorCodeType code) {
+        return makeCommandError(
+            "TransferAsset",
+            code,
+            shared_model::detail::PrettyStringBuilder()
+                .init("Query arguments")
+                .append("src_account_id", src_account_id)
+                .append("dest_account_id", dest_account_id)
+                .append("asset_id", asset_id)
+                .append("amount", amount)
+                .append("precision", std::to_string(amount_precision))
+                .finalize());
+      };
+
+      try {
+        const auto &src = permissions(src_account_id);
+        const auto &dest = permissions(dest_account_id);
+        if (do_validation_
+            and not(dest and dest->test(Role::kReceive) and src
+                    and src->test(Role::kTransfer))) {
+          return error(2);
+        }
+        if (not dest) {
+          return error(4);
+        }
+        if (not src) {
+          return error(3);
+        }
+        const auto asset_precision = precision(asset_id);
+        if (not asset_precision or *asset_precision < amount_precision) {
+          return error(5);
+        }
+        auto units = toBalance(Wide(command.amount().intValue())
+                               * pow10(*asset_precision - amount_precision));
+        auto src_entry = entry(touched[0], *asset_precision);
+        auto dest_entry = entry(touched[1], *asset_precision);
+        if (not units or not src_entry or not dest_entry) {
+          return delegate(command, touched);
+        }
+        if (src_entry->current < *units) {
+          return error(6);
+        }
+        Wide dest_value = Wide(dest_entry->current) + Wide(*units);
+        if (dest_value >= limit(amount_precision, *asset_precision)) {
+          return error(7);
+        }
+        auto new_dest_value = toBalance(dest_value);
+        if (not new_dest_value) {
+          return delegate(command, touched);
+        }
+
+        Entry new_src = *src_entry, new_dest = *dest_entry;
+        new_src.current -= *units;
+        new_src.scale = std::max(new_src.scale, amount_precision);
+        new_dest.current = *new_dest_value;
+        new_dest.scale = std::max(new_dest.scale, amount_precision);
+        update(touched[0], new_src);
+        update(touched[1], new_dest);
+        return {};
+      } catch (const std::exception &e) {
+        log_->error("TransferAsset failed: {}", e.what());
+        return error(1);
+      }
+    }
+
+    size_t InMemoryBalanceExecutor::savepoint() const {
+      return undo_log_.size();
+    }
+
+    void InMemoryBalanceExecutor::rollback(size_t mark) {
+      while (undo_log_.size() > mark) {
+        auto &undo = undo_log_.back();
+        if (undo.second) {
+          balances_[undo.first] = *undo.second;
+        } else {
+          balances_.erase(undo.first);
+        }
+        undo_log_.pop_back();
+      }
+      // rolled back commands could create accounts and assets or change
+      // permissions
+      accounts_.clear();
+      assets_.clear();
+    }
+
+    expected::Result<void, std::string> InMemoryBalanceExecutor::flush() {
+      std::vector<std::string> accounts, assets, deltas;
+      std::vector<std::pair<BalanceKey, Entry>> flushed;
+      for (const auto &balance : balances_) {
+        const auto &entry = balance.second;
+        if (entry.current == entry.base) {
+          continue;
+        }
+        accounts.push_back(balance.first.first);
+        assets.push_back(balance.first.second);
+        deltas.push_back(formatDelta(
+            entry.base, entry.current, entry.precision, entry.scale));
+        flushed.emplace_back(balance);
+      }
+      if (flushed.empty()) {
+        return {};
+      }
+
+      auto accounts_array = makeArray(accounts);
+      auto assets_array = makeArray(assets);
+      auto deltas_array = makeArray(deltas);
+      try {
+        sql_ << kWriteBalances, soci::use(accounts_array, "accounts"),
+            soci::use(assets_array, "assets"),
+            soci::use(deltas_array, "deltas");
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string("Failed to write balances: ") + e.what());
+      }
+
+      for (auto &balance : flushed) {
+        balance.second.base = balance.second.current;
+        update(balance.first, balance.second);
+      }
+      log_->debug("wrote {} balances", flushed.size());
+      return {};
+    }
+
+    template <typename Command>
+    CommandResult InMemoryBalanceExecutor::delegate(
+        const Command &command, const std::vector<BalanceKey> &touched) {
+      if (touched.empty()) {
+        auto result = (*executor_)(command);
+        accounts_.clear();
+        assets_.clear();
+        return result;
+      }
+
+      // the wrapped executor reads balances from the database
+      auto dirty =
+          std::any_of(touched.begin(), touched.end(), [this](auto &key) {
+            auto it = balances_.find(key);
+            return it != balances_.end()
+                and it->second.current != it->second.base;
+          });
+      if (dirty) {
+        auto flushed = flush();
+        if (auto e = boost::get<expected::Error<std::string>>(&flushed)) {
+          return makeCommandError("WriteBalances", 1, e->error);
+        }
+      }
+      auto result = (*executor_)(command);
+      for (const auto &key : touched) {
+        if (balances_.count(key) != 0) {
+          update(key, boost::none);
+        }
+      }
+      return result;
+    }
+
+    const boost::optional<shared_model::interface::RolePermissionSet>
+        &InMemoryBalanceExecutor::permissions(
+            const shared_model::interface::types::AccountIdType &account_id) {
+      auto it = accounts_.find(account_id);
+      if (it != accounts_.end()) {
+        return it->second;
+      }
+      boost::optional<std::string> bits;
+      sql_ << kSelectPermissions, soci::into(bits),
+          soci::use(account_id, "account_id");
+      boost::optional<shared_model::interface::RolePermissionSet> result;
+      if (bits) {
+        result = shared_model::interface::RolePermissionSet(*bits);
+      }
+      return accounts_.emplace(account_id, std::move(result)).first->second;
+    }
+
+    const boost::optional<shared_model::interface::types::PrecisionType>
+        &InMemoryBalanceExecutor::precision(
+            const shared_model::interface::types::AssetIdType &asset_id) {
+      auto it = assets_.find(asset_id);
+      if (it != assets_.end()) {
+        return it->second;
+      }
+      boost::optional<int> value;
+      sql_ << kSelectPrecision, soci::into(value),
+          soci::use(asset_id, "asset_id");
+      boost::optional<PrecisionType> result;
+      if (value) {
+        result = static_cast<PrecisionType>(*value);
+      }
+      return assets_.emplace(asset_id, result).first->second;
+    }
+
+    boost::optional<InMemoryBalanceExecutor::Entry &>
+    InMemoryBalanceExecutor::entry(
+        const BalanceKey &key,
+        shared_model::interface::types::PrecisionType precision) {
+      auto it = balances_.find(key);
+      if (it != balances_.end()) {
+        return it->second;
+      }
+      boost::optional<std::string> amount;
+      sql_ << kSelectBalance, soci::into(amount),
+          soci::use(key.first, "account_id"),
+          soci::use(key.second, "asset_id");
+      auto value = parseDecimal(amount.value_or("0"), precision);
+      if (not value) {
+        return boost::none;
+      }
+      update(key, Entry{value->first, value->first, precision, value->second});
+      return balances_.at(key);
+    }
+
+    void InMemoryBalanceExecutor::update(const BalanceKey &key,
+                                         boost::optional<Entry> value) {
+      auto it = balances_.find(key);
+      undo_log_.emplace_back(
+          key,
+          it == balances_.end() ? boost::none
+                                : boost::make_optional(it->second));
+      if (value) {
+        balances_[key] = *value;
+      } else if (it != balances_.end()) {
+        balances_.erase(it);
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,209 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IN_MEMORY_BALANCE_EXECUTOR_HPP
+#define IROHA_IN_MEMORY_BALANCE_EXECUTOR_HPP
+
+#include "ametsuchi/command_executor.hpp"
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <soci/soci.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "interfaces/permissions.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Command executor which applies AddAssetQuantity and TransferAsset of
+     * hot assets to balances kept in memory as fixed point integers, and
+     * passes all other commands to the wrapped executor.
+     *
+     * Accounts, assets and balances are read once per session, the net change
+     * of balances is written back by flush(). Balances are flushed before the
+     * wrapped executor runs a command which changes balances, so the database
+     * stays the source of truth for such commands.
+     */
+    class InMemoryBalanceExecutor : public CommandExecutor {
+     public:
+      /**
+       * @param sql - session of the wrapped executor
+       * @param executor - executor of commands which are not handled here
+       * @param hot_assets - assets whose balances are kept in memory
+       */
+      InMemoryBalanceExecutor(
+          soci::session &sql,
+          std::unique_ptr<CommandExecutor> executor,
+          std::unordered_set<shared_model::interface::types::AssetIdType>
+              hot_assets,
+          logger::Logger log = logger::log("InMemoryBalanceExecutor"));
+
+      void setCreatorAccountId(
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id) override;
+
+      void doValidation(bool do_validation) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddAssetQuantity &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddPeer &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AppendRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAccount &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAsset &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateDomain &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::DetachRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::GrantPermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RemoveSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RevokePermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetAccountDetail &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetQuorum &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SubtractAssetQuantity &command)
+          override;
+
+      CommandResult operator()(
+          const shared_model::interface::TransferAsset &command) override;
+
+      /**
+       * @return mark of the current state, which can be restored by rollback
+       */
+      size_t savepoint() const;
+
+      /**
+       * Restore balances to the state of the mark, must be called together
+       * with rollback of the sql savepoint created with the mark
+       * @param mark - value returned by savepoint()
+       */
+      void rollback(size_t mark);
+
+      /**
+       * Write net change of balances to the database
+       * @return error message in case of failure
+       */
+      expected::Result<void, std::string> flush();
+
+     private:
+      using Balance = boost::multiprecision::uint256_t;
+      using BalanceKey =
+          std::pair<shared_model::interface::types::AccountIdType,
+                    shared_model::interface::types::AssetIdType>;
+
+      /// balance of an account in units of the asset precision
+      struct Entry {
+        /// value stored in the database
+        Balance base;
+        /// value after applied commands
+        Balance current;
+        /// precision of the asset
+        shared_model::interface::types::PrecisionType precision;
+        /// scale of the value in the database after write-back, which
+        /// matches decimal arithmetic of the wrapped executor
+        shared_model::interface::types::PrecisionType scale;
+      };
+
+      /**
+       * Pass the command to the wrapped executor
+       * @param touched - balances changed by the command, they are flushed
+       * before execution and reloaded afterwards
+       */
+      template <typename Command>
+      CommandResult delegate(const Command &command,
+                             const std::vector<BalanceKey> &touched);
+
+      /**
+       * @return role permissions of the account, none if there is no such
+       * account
+       * @throws if the query fails
+       */
+      const boost::optional<shared_model::interface::RolePermissionSet>
+          &permissions(const shared_model::interface::types::AccountIdType
+                           &account_id);
+
+      /**
+       * @return precision of the asset, none if there is no such asset
+       * @throws if the query fails
+       */
+      const boost::optional<shared_model::interface::types::PrecisionType>
+          &precision(const shared_model::interface::types::AssetIdType
+                         &asset_id);
+
+      /**
+       * @return balance entry, none if the stored value does not fit into
+       * fixed point representation
+       * @throws if the query fails
+       */
+      boost::optional<Entry &> entry(
+          const BalanceKey &key,
+          shared_model::interface::types::PrecisionType precision);
+
+      /**
+       * Replace the entry and record its previous state for rollback
+       */
+      void update(const BalanceKey &key, boost::optional<Entry> value);
+
+      soci::session &sql_;
+      std::unique_ptr<CommandExecutor> executor_;
+      std::unordered_set<shared_model::interface::types::AssetIdType>
+          hot_assets_;
+
+      shared_model::interface::types::AccountIdType creator_account_id_;
+      bool do_validation_;
+
+      /// accounts and assets read in this session, dropped after any command
+      /// executed by the wrapped executor and on rollback
+      std::unordered_map<
+          shared_model::interface::types::AccountIdType,
+          boost::optional<shared_model::interface::RolePermissionSet>>
+          accounts_;
+      std::unordered_map<
+          shared_model::interface::types::AssetIdType,
+          boost::optional<shared_model::interface::types::PrecisionType>>
+          assets_;
+
+      std::map<BalanceKey, Entry> balances_;
+
+      /// previous states of changed entries, none for inserted ones
+      std::vector<std::pair<BalanceKey, boost::optional<Entry>>> undo_log_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_BALANCE_EXECUTOR_HPP
@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/mapped_bytes_view.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    boost::optional<std::unique_ptr<KeyValueStorage::BytesView>>
+    MappedBytesView::create(int fd, uint64_t offset, size_t size) {
+      // empty regions cannot be mapped
+      if (size == 0) {
+        std::unique_ptr<KeyValueStorage::BytesView> empty =
+            std::make_unique<KeyValueStorage::OwnedBytesView>(
+                KeyValueStorage::Bytes{});
+        return boost::make_optional(std::move(empty));
+      }
+
+      // mapping offset must be a multiple of the page size
+      static const uint64_t page_size = ::sysconf(_SC_PAGE_SIZE);
+      const auto padding = offset % page_size;
+      const auto mapping_size = size + padding;
+
+      auto mapping = ::mmap(nullptr,
+                            mapping_size,
+                            PROT_READ,
+                            MAP_SHARED,
+                            fd,
+                            static_cast<off_t>(offset - padding));
+      if (mapping == MAP_FAILED) {
+        return boost::none;
+      }
+      ::madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+
+      std::unique_ptr<KeyValueStorage::BytesView> view(
+          new MappedBytesView(mapping,
+                              mapping_size,
+                              static_cast<const uint8_t *>(mapping) + padding,
+                              size));
+      return boost::make_optional(std::move(view));
+    }
+
+    const uint8_t *MappedBytesView::data() const {
+      return data_;
+    }
+
+    size_t MappedBytesView::size() const {
+      return size_;
+    }
+
+    MappedBytesView::~MappedBytesView() {
+      ::munmap(mapping_, mapping_size_);
+    }
+
+    MappedBytesView::MappedBytesView(void *mapping,
+                                     size_t mapping_size,
+                                     const uint8_t *data,
+                                     size_t size)
+        : mapping_(mapping),
+          mapping_size_(mapping_size),
+          data_(data),
+          size_(size) {}
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MAPPED_BYTES_VIEW_HPP
+#define IROHA_MAPPED_BYTES_VIEW_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Read-only view of a file region mapped into memory. The mapping is
+     * released when the view is destroyed
+     */
+    class MappedBytesView : public KeyValueStorage::BytesView {
+     public:
+      /**
+       * Map a region of an open file
+       * @param fd - file descriptor opened for reading, may be closed right
+       * after the call
+       * @param offset - offset of the region in the file
+       * @param size - size of the region
+       * @return view of the region, none if mapping failed
+       */
+      static boost::optional<std::unique_ptr<KeyValueStorage::BytesView>>
+      create(int fd, uint64_t offset, size_t size);
+
+      const uint8_t *data() const override;
+
+      size_t size() const override;
+
+      ~MappedBytesView() override;
+
+      MappedBytesView(const MappedBytesView &) = delete;
+      MappedBytesView &operator=(const MappedBytesView &) = delete;
+
+     private:
+      MappedBytesView(void *mapping,
+                      size_t mapping_size,
+                      const uint8_t *data,
+                      size_t size);
+
+      void *mapping_;
+      size_t mapping_size_;
+      const uint8_t *data_;
+      size_t size_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_MAPPED_BYTES_VIEW_HPP
@@ -5,6 +5,10 @@
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
 
+#include <map>
+#include <set>
+#include <tuple>
+
 #include <boost/range/adaptor/indexed.hpp>
 
 #include "ametsuchi/tx_cache_response.hpp"
@@ -27,135 +31,142 @@ namespace {
         [](const auto &) -> ReturnType { return boost::none; });
   }
 
-  // make index tx hash -> block where hash is stored
-  std::string makeHashIndex(
-      const shared_model::interface::types::HashType &hash,
-      shared_model::interface::types::HeightType height,
-      size_t index) {
-    boost::format base(
-        "INSERT INTO position_by_hash(hash, height, index) VALUES ('%s', "
-        "'%s', '%s');");
-    return (base % hash.hex() % height % index).str();
-  }
-
-  std::string makeCommittedTxHashIndex(
-      const shared_model::interface::types::HashType &rejected_tx_hash) {
-    boost::format base(
-        "INSERT INTO tx_status_by_hash(hash, status) VALUES ('%s', "
-        "TRUE);");
-    return (base % rejected_tx_hash.hex()).str();
-  }
-
-  std::string makeRejectedTxHashIndex(
-      const shared_model::interface::types::HashType &rejected_tx_hash) {
-    boost::format base(
-        "INSERT INTO tx_status_by_hash(hash, status) VALUES ('%s', "
-        "FALSE);");
-    return (base % rejected_tx_hash.hex()).str();
-  }
-
-  // make index account_id:height -> list of tx indexes
+  // index tx hash -> block where hash is stored
+  const std::string kInsertHashIndex = R"(
+INSERT INTO position_by_hash(hash, height, index)
+SELECT hash, CAST(:height AS bigint), index
+FROM unnest(CAST(:hashes AS varchar[]), CAST(:indices AS bigint[]))
+AS t(hash, index))";
+
+  // index tx hash -> status of committed and rejected transactions
+  const std::string kInsertTxStatusIndex = R"(
+INSERT INTO tx_status_by_hash(hash, status)
+SELECT * FROM unnest(CAST(:hashes AS varchar[]), CAST(:statuses AS boolean[]))
+ON CONFLICT (hash) DO UPDATE SET status = EXCLUDED.status OR
+    tx_status_by_hash.status)";
+
+  // index account_id:height -> list of tx indexes
   // (where tx is placed in the block)
-  std::string makeCreatorHeightIndex(
-      const shared_model::interface::types::AccountIdType creator,
-      shared_model::interface::types::HeightType height,
-      size_t tx_index) {
-    boost::format base(
-        "INSERT INTO index_by_creator_height(creator_id, height, index) VALUES "
-        "('%s', '%s', '%s');");
-    return (base % creator % height % tx_index).str();
-  }
+  const std::string kInsertCreatorHeightIndex = R"(
+INSERT INTO index_by_creator_height(creator_id, height, index)
+SELECT creator_id, CAST(:height AS bigint), index
+FROM unnest(CAST(:creators AS text[]), CAST(:indices AS bigint[]))
+AS t(creator_id, index))";
+
+  // index account_id -> list of blocks where his txs exist
+  const std::string kInsertAccountHeightIndex = R"(
+INSERT INTO height_by_account_set(account_id, height)
+SELECT account_id, CAST(:height AS bigint)
+FROM unnest(CAST(:accounts AS text[])) AS t(account_id)
+ON CONFLICT DO NOTHING)";
+
+  // index account_id:height:asset_id -> list of tx indexes
+  const std::string kInsertAccountAssetIndex = R"(
+INSERT INTO position_by_account_asset(account_id, asset_id, height, index)
+SELECT account_id, asset_id, CAST(:height AS bigint), index
+FROM unnest(CAST(:accounts AS text[]),
+            CAST(:assets AS text[]),
+            CAST(:indices AS bigint[]))
+AS t(account_id, asset_id, index)
+ON CONFLICT DO NOTHING)";
+}  // namespace
 
-  // Make index account_id -> list of blocks where his txs exist
-  std::string makeAccountHeightIndex(
-      const shared_model::interface::types::AccountIdType &account_id,
-      shared_model::interface::types::HeightType height) {
-    boost::format base(
-        "INSERT INTO height_by_account_set(account_id, "
-        "height) VALUES "
-        "('%s', '%s');");
-    return (base % account_id % height).str();
-  }
+namespace iroha {
+  namespace ametsuchi {
+    PostgresBlockIndex::PostgresBlockIndex(soci::session &sql,
+                                           logger::Logger log)
+        : sql_(sql), log_(std::move(log)) {}
 
-  // Collect all assets belonging to creator, sender, and receiver
-  // to make account_id:height:asset_id -> list of tx indexes
-  // for transfer asset in command
-  std::string makeAccountAssetIndex(
-      const shared_model::interface::types::AccountIdType &account_id,
-      shared_model::interface::types::HeightType height,
-      size_t index,
-      const shared_model::interface::Transaction::CommandsType &commands) {
-    return std::accumulate(
-        commands.begin(),
-        commands.end(),
-        std::string{},
-        [&](auto query, const auto &cmd) {
+    void PostgresBlockIndex::index(
+        const shared_model::interface::Block &block) {
+      const auto height = std::to_string(block.height());
+
+      // columns of inserted rows, one entry per transaction
+      std::vector<std::string> tx_hashes, creators;
+      std::vector<size_t> tx_indices;
+      // status of committed and rejected transactions
+      std::map<std::string, bool> status_by_hash;
+      // sets of unique rows
+      std::set<std::string> accounts;
+      std::set<std::tuple<std::string, std::string, size_t>> account_assets;
+
+      for (const auto &tx :
+           block.transactions() | boost::adaptors::indexed(0)) {
+        const auto &creator_id = tx.value().creatorAccountId();
+        const auto hash = tx.value().hash().hex();
+        const size_t index = tx.index();
+
+        tx_hashes.push_back(hash);
+        creators.push_back(creator_id);
+        tx_indices.push_back(index);
+        status_by_hash[hash] = true;
+        accounts.insert(creator_id);
+
+        for (const auto &cmd : tx.value().commands()) {
           auto transfer = getTransferAsset(cmd);
           if (not transfer) {
-            return query;
+            continue;
           }
           const auto &src_id = transfer.value().srcAccountId();
           const auto &dest_id = transfer.value().destAccountId();
-
-          query += makeAccountHeightIndex(src_id, height);
-          query += makeAccountHeightIndex(dest_id, height);
-
-          const auto ids = {account_id, src_id, dest_id};
           const auto &asset_id = transfer.value().assetId();
-          // flat map accounts to unindexed keys
-          for (const auto &id : ids) {
-            boost::format base(
-                "INSERT INTO position_by_account_asset(account_id, "
-                "height, asset_id, "
-                "index) "
-                "VALUES ('%s', '%s', '%s', '%s');");
-            query += (base % id % height % asset_id % index).str();
+
+          accounts.insert(src_id);
+          accounts.insert(dest_id);
+          for (const auto &id : {creator_id, src_id, dest_id}) {
+            account_assets.emplace(id, asset_id, index);
           }
-          return query;
-        });
-  }
-}  // namespace
+        }
+      }
+      for (const auto &hash : block.rejected_transactions_hashes()) {
+        status_by_hash.emplace(hash.hex(), false);
+      }
 
-namespace iroha {
-  namespace ametsuchi {
-    PostgresBlockIndex::PostgresBlockIndex(soci::session &sql,
-                                           logger::Logger log)
-        : sql_(sql), log_(std::move(log)) {}
+      std::vector<std::string> asset_accounts, asset_ids;
+      std::vector<size_t> asset_indices;
+      for (const auto &row : account_assets) {
+        asset_accounts.push_back(std::get<0>(row));
+        asset_ids.push_back(std::get<1>(row));
+        asset_indices.push_back(std::get<2>(row));
+      }
+      std::vector<std::string> status_hashes;
+      std::vector<bool> statuses;
+      for (const auto &status : status_by_hash) {
+        status_hashes.push_back(status.first);
+        statuses.push_back(status.second);
+      }
 
-    void PostgresBlockIndex::index(
-        const shared_model::interface::Block &block) {
-      auto height = block.height();
-      auto indexed_txs = block.transactions() | boost::adaptors::indexed(0);
-      auto rejected_txs_hashes = block.rejected_transactions_hashes();
-      std::string tx_index_query = std::accumulate(
-          indexed_txs.begin(),
-          indexed_txs.end(),
-          std::string{},
-          [height](auto query, const auto &tx) {
-            const auto &creator_id = tx.value().creatorAccountId();
-            const auto index = tx.index();
-
-            query += makeAccountHeightIndex(creator_id, height);
-            query += makeAccountAssetIndex(
-                creator_id, height, index, tx.value().commands());
-            query += makeHashIndex(tx.value().hash(), height, index);
-            query += makeCommittedTxHashIndex(tx.value().hash());
-            query += makeCreatorHeightIndex(creator_id, height, index);
-            return query;
-          });
-
-      std::string rejected_tx_index_query =
-          std::accumulate(rejected_txs_hashes.begin(),
-                          rejected_txs_hashes.end(),
-                          std::string{},
-                          [](auto query, const auto &rejected_tx_hash) {
-                            query += makeRejectedTxHashIndex(rejected_tx_hash);
-                            return query;
-                          });
-
-      auto index_query = tx_index_query + rejected_tx_index_query;
+      // parameters are bound by reference, so arrays must outlive statements
+      const auto hashes = makeArray(tx_hashes);
+      const auto indices = makeArray(tx_indices);
+      const auto creator_ids = makeArray(creators);
+      const auto account_ids = makeArray(accounts);
+      const auto asset_account_ids = makeArray(asset_accounts);
+      const auto asset_id_column = makeArray(asset_ids);
+      const auto asset_index_column = makeArray(asset_indices);
+      const auto status_hash_column = makeArray(status_hashes);
+      const auto status_column = makeArray(statuses);
       try {
-        sql_ << index_query;
+        if (not tx_hashes.empty()) {
+          sql_ << kInsertHashIndex, soci::use(height, "height"),
+              soci::use(hashes, "hashes"), soci::use(indices, "indices");
+          sql_ << kInsertCreatorHeightIndex, soci::use(height, "height"),
+              soci::use(creator_ids, "creators"),
+              soci::use(indices, "indices");
+          sql_ << kInsertAccountHeightIndex, soci::use(height, "height"),
+              soci::use(account_ids, "accounts");
+        }
+        if (not account_assets.empty()) {
+          sql_ << kInsertAccountAssetIndex, soci::use(height, "height"),
+              soci::use(asset_account_ids, "accounts"),
+              soci::use(asset_id_column, "assets"),
+              soci::use(asset_index_column, "indices");
+        }
+        if (not status_by_hash.empty()) {
+          sql_ << kInsertTxStatusIndex,
+              soci::use(status_hash_column, "hashes"),
+              soci::use(status_column, "statuses");
+        }
       } catch (const std::exception &e) {
         log_->error(e.what());
       }
@@ -33,6 +33,9 @@ namespace iroha {
        *     c. destination account
        *   2. account -> block for source and destination accounts
        *   3. (account, height) -> list of txes
+       *
+       * Rows of each index table are collected into columns and inserted
+       * by a single statement which unnests them on the server side
        */
       void index(const shared_model::interface::Block &block) override;
 
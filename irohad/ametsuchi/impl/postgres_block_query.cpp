@@ -10,7 +10,6 @@
 #include <boost/range/algorithm/for_each.hpp>
 
 #include "ametsuchi/impl/soci_utils.hpp"
-#include "common/byteutils.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -22,7 +21,7 @@ namespace iroha {
         logger::Logger log)
         : sql_(sql),
           block_store_(file_store),
-          converter_(std::move(converter)),
+          block_format_(std::move(converter)),
           log_(std::move(log)) {}
 
     PostgresBlockQuery::PostgresBlockQuery(
@@ -34,7 +33,7 @@ namespace iroha {
         : psql_(std::move(sql)),
           sql_(*psql_),
           block_store_(file_store),
-          converter_(std::move(converter)),
+          block_format_(std::move(converter)),
           log_(std::move(log)) {}
 
     std::vector<BlockQuery::wBlock> PostgresBlockQuery::getBlocks(
@@ -122,12 +121,13 @@ namespace iroha {
                      std::string>
     PostgresBlockQuery::getBlock(
         shared_model::interface::types::HeightType id) const {
-      auto serialized_block = block_store_.get(id);
+      auto serialized_block = block_store_.getView(id);
       if (not serialized_block) {
         auto error = boost::format("Failed to retrieve block with id %d") % id;
         return expected::makeError(error.str());
       }
-      return converter_->deserialize(bytesToString(*serialized_block));
+      return block_format_.deserialize((*serialized_block)->data(),
+                                       (*serialized_block)->size());
     }
   }  // namespace ametsuchi
 }  // namespace iroha
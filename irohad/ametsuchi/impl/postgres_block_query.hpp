@@ -10,6 +10,7 @@
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
+#include "ametsuchi/impl/block_file_format.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "interfaces/iroha_internal/block_json_deserializer.hpp"
 #include "logger/logger.hpp"
@@ -68,8 +69,7 @@ namespace iroha {
       soci::session &sql_;
 
       KeyValueStorage &block_store_;
-      std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
-          converter_;
+      BlockFileFormat block_format_;
 
       logger::Logger log_;
     };
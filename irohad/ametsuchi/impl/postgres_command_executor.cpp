@@ -807,6 +807,103 @@ namespace iroha {
       do_validation_ = do_validation;
     }
 
+    template <typename QueryArgsCallable>
+    CommandResult PostgresCommandExecutor::executeCommand(
+        const std::string &cmd,
+        std::string command_name,
+        QueryArgsCallable &&query_args) {
+      if (batch_) {
+        batch_->push_back({cmd, std::move(command_name), query_args()});
+        return {};
+      }
+      return executeQuery(sql_,
+                          cmd,
+                          std::move(command_name),
+                          std::forward<QueryArgsCallable>(query_args));
+    }
+
+    void PostgresCommandExecutor::beginBatch() {
+      batch_ = std::vector<BatchedCommand>{};
+    }
+
+    expected::Result<void, std::pair<size_t, CommandError>>
+    PostgresCommandExecutor::executeBatch(
+        const std::vector<std::string> &prologue) {
+      auto commands = batch_.value_or(std::vector<BatchedCommand>{});
+      batch_ = boost::none;
+
+      // statements are sent as a single simple query, postgres returns a
+      // result for each of them and skips the rest after the first error
+      std::string query;
+      for (const auto &statement : prologue) {
+        query += statement + ";\n";
+      }
+      for (const auto &command : commands) {
+        query += command.statement + ";\n";
+      }
+
+      boost::optional<std::pair<size_t, CommandError>> error;
+      auto set_error = [&error](size_t index, CommandResult result) {
+        result.match([](const expected::Value<void> &) {},
+                     [&error, index](const expected::Error<CommandError> &e) {
+                       error = std::make_pair(index, e.error);
+                     });
+      };
+      // failure of the query itself or of the prologue is reported as a
+      // failure of the first command
+      auto set_batch_error = [&](std::string message) {
+        set_error(0,
+                  makeCommandError(commands.empty()
+                                       ? std::string{"Batch"}
+                                       : commands.front().command_name,
+                                   1,
+                                   [&message] { return message; }));
+      };
+
+      auto *conn =
+          static_cast<soci::postgresql_session_backend *>(sql_.get_backend())
+              ->conn_;
+      if (PQsendQuery(conn, query.c_str()) == 0) {
+        set_batch_error(PQerrorMessage(conn));
+      }
+
+      size_t statement = 0;
+      while (PGresult *result = PQgetResult(conn)) {
+        auto status = PQresultStatus(result);
+        auto index = statement - prologue.size();
+        if (error) {
+          // results are drained to keep the connection usable
+        } else if (statement < prologue.size()) {
+          if (status != PGRES_COMMAND_OK) {
+            set_batch_error(PQresultErrorMessage(result));
+          }
+        } else if (index < commands.size()) {
+          auto &command = commands[index];
+          auto query_args = [&command] { return command.query_args; };
+          if (status != PGRES_TUPLES_OK) {
+            set_error(index,
+                      getCommandError(std::move(command.command_name),
+                                      PQresultErrorMessage(result),
+                                      query_args));
+          } else if (PQntuples(result) > 0) {
+            auto code = std::strtoul(PQgetvalue(result, 0, 0), nullptr, 10);
+            if (code != 0) {
+              set_error(index,
+                        makeCommandError(
+                            std::move(command.command_name), code, query_args));
+            }
+          }
+        }
+        PQclear(result);
+        ++statement;
+      }
+
+      if (error) {
+        return expected::makeError(std::move(*error));
+      }
+      return {};
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command) {
       auto &account_id = creator_account_id_;
@@ -830,8 +927,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "AddAssetQuantity", std::move(str_args));
+      return executeCommand(cmd.str(), "AddAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -850,7 +946,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddPeer", std::move(str_args));
+      return executeCommand(cmd.str(), "AddPeer", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -870,7 +966,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddSignatory", std::move(str_args));
+      return executeCommand(cmd.str(), "AddSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -890,7 +986,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AppendRole", std::move(str_args));
+      return executeCommand(cmd.str(), "AppendRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -915,8 +1011,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "CreateAccount", std::move(str_args));
+      return executeCommand(cmd.str(), "CreateAccount", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -938,7 +1033,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateAsset", std::move(str_args));
+      return executeCommand(cmd.str(), "CreateAsset", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -958,7 +1053,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateDomain", std::move(str_args));
+      return executeCommand(cmd.str(), "CreateDomain", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -981,7 +1076,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateRole", std::move(str_args));
+      return executeCommand(cmd.str(), "CreateRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1001,7 +1096,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "DetachRole", std::move(str_args));
+      return executeCommand(cmd.str(), "DetachRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1032,8 +1127,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "GrantPermission", std::move(str_args));
+      return executeCommand(cmd.str(), "GrantPermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1053,8 +1147,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RemoveSignatory", std::move(str_args));
+      return executeCommand(cmd.str(), "RemoveSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1087,8 +1180,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RevokePermission", std::move(str_args));
+      return executeCommand(cmd.str(), "RevokePermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1121,8 +1213,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SetAccountDetail", std::move(str_args));
+      return executeCommand(cmd.str(), "SetAccountDetail", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1142,7 +1233,7 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "SetQuorum", std::move(str_args));
+      return executeCommand(cmd.str(), "SetQuorum", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1168,8 +1259,8 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SubtractAssetQuantity", std::move(str_args));
+      return executeCommand(
+          cmd.str(), "SubtractAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1198,8 +1289,7 @@ namespace iroha {
                 .finalize();
           };
 
-      return executeQuery(
-          sql_, cmd.str(), "TransferAsset", std::move(str_args));
+      return executeCommand(cmd.str(), "TransferAsset", std::move(str_args));
     }
 
     void PostgresCommandExecutor::prepareStatements(soci::session &sql) {
@@ -7,6 +7,10 @@
 #define IROHA_POSTGRES_COMMAND_EXECUTOR_HPP
 
 #include "ametsuchi/command_executor.hpp"
+
+#include <vector>
+
+#include <boost/optional.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
 
 namespace shared_model {
@@ -80,9 +84,42 @@ namespace iroha {
       CommandResult operator()(
           const shared_model::interface::TransferAsset &command) override;
 
+      /**
+       * Collect statements of executed commands instead of sending them one
+       * by one, commands return success until executeBatch() is called
+       */
+      void beginBatch();
+
+      /**
+       * Send statements collected since beginBatch() to the database in a
+       * single round trip and stop collecting
+       * @param prologue - statements executed before the commands in the same
+       * round trip
+       * @return index of the first failed command and its error. Commands
+       * following the failed one may still be applied, so the caller must
+       * roll the changes back
+       */
+      expected::Result<void, std::pair<size_t, CommandError>> executeBatch(
+          const std::vector<std::string> &prologue = {});
+
       static void prepareStatements(soci::session &sql);
 
      private:
+      /// statement of a command collected in batch mode
+      struct BatchedCommand {
+        std::string statement;
+        std::string command_name;
+        std::string query_args;
+      };
+
+      /**
+       * Execute statement of a command, or add it to the batch in batch mode
+       */
+      template <typename QueryArgsCallable>
+      CommandResult executeCommand(const std::string &cmd,
+                                   std::string command_name,
+                                   QueryArgsCallable &&query_args);
+
       soci::session &sql_;
       bool do_validation_;
 
@@ -90,6 +127,10 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      /// commands collected in batch mode, none if commands are executed
+      /// immediately
+      boost::optional<std::vector<BatchedCommand>> batch_;
+
       // 14.09.18 nickaleks: IR-1708 Load SQL from separate files
       static const std::string addAssetQuantityBase;
       static const std::string addPeerBase;
@@ -155,13 +155,13 @@ namespace iroha {
                                                            RangeGen &&range_gen,
                                                            Pred &&pred) {
       std::vector<std::unique_ptr<shared_model::interface::Transaction>> result;
-      auto serialized_block = block_store_.get(block_id);
+      auto serialized_block = block_store_.getView(block_id);
       if (not serialized_block) {
         log_->error("Failed to retrieve block with id {}", block_id);
         return result;
       }
-      auto deserialized_block =
-          converter_->deserialize(bytesToString(*serialized_block));
+      auto deserialized_block = block_format_.deserialize(
+          (*serialized_block)->data(), (*serialized_block)->size());
       // boost::get of pointer returns pointer to requested type, or nullptr
       if (auto e =
               boost::get<expected::Error<std::string>>(&deserialized_block)) {
@@ -242,6 +242,7 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
+        std::shared_ptr<WsvQuery> wsv_query,
         logger::Logger log)
         : sql_(std::move(sql)),
           block_store_(block_store),
@@ -251,7 +252,8 @@ namespace iroha {
                    pending_txs_storage_,
                    std::move(converter),
                    response_factory,
-                   perm_converter),
+                   perm_converter,
+                   std::move(wsv_query)),
           query_response_factory_{std::move(response_factory)},
           log_(std::move(log)) {}
 
@@ -266,10 +268,13 @@ namespace iroha {
         const shared_model::interface::BlocksQuery &query) {
       using T = boost::tuple<int>;
       boost::format cmd(R"(%s)");
+      visitor_.setCreatorId(query.creatorAccountId());
       try {
         soci::rowset<T> st =
-            (sql_->prepare
-                 << (cmd % checkAccountRolePermission(Role::kGetBlocks)).str(),
+            (sql_->prepare << (cmd
+                               % visitor_.checkAccountRolePermission(
+                                     Role::kGetBlocks))
+                                  .str(),
              soci::use(query.creatorAccountId(), "role_account_id"));
 
         return st.begin()->get<0>();
@@ -288,18 +293,71 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
+        std::shared_ptr<WsvQuery> wsv_query,
         logger::Logger log)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
-          converter_(std::move(converter)),
+          block_format_(std::move(converter)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
+          wsv_query_(std::move(wsv_query)),
           log_(std::move(log)) {}
 
     void PostgresQueryExecutorVisitor::setCreatorId(
         const shared_model::interface::types::AccountIdType &creator_id) {
       creator_id_ = creator_id;
+      creator_permissions_ = boost::none;
+      if (not wsv_query_) {
+        return;
+      }
+      auto roles = wsv_query_->getAccountRoles(creator_id);
+      if (not roles) {
+        return;
+      }
+      shared_model::interface::RolePermissionSet permissions;
+      for (const auto &role : *roles) {
+        auto role_permissions = wsv_query_->getRolePermissions(role);
+        if (not role_permissions) {
+          return;
+        }
+        permissions |= *role_permissions;
+      }
+      creator_permissions_ = permissions;
+    }
+
+    std::string PostgresQueryExecutorVisitor::checkAccountRolePermission(
+        Role permission, const std::string &account_alias) const {
+      if (not creator_permissions_) {
+        return ::checkAccountRolePermission(permission, account_alias);
+      }
+      // keep the parameter in the query, since it is bound by the caller
+      return (boost::format(
+                  "SELECT %1% AS perm FROM (SELECT CAST(:%2% AS text)) AS c")
+              % (creator_permissions_->test(permission) ? "TRUE" : "FALSE")
+              % account_alias)
+          .str();
+    }
+
+    std::string PostgresQueryExecutorVisitor::hasQueryPermission(
+        const shared_model::interface::types::AccountIdType &creator,
+        const shared_model::interface::types::AccountIdType &target_account,
+        Role indiv_permission_id,
+        Role all_permission_id,
+        Role domain_permission_id) const {
+      if (not creator_permissions_) {
+        return ::hasQueryPermission(creator,
+                                    target_account,
+                                    indiv_permission_id,
+                                    all_permission_id,
+                                    domain_permission_id);
+      }
+      bool has_perm = (creator == target_account
+                       and creator_permissions_->test(indiv_permission_id))
+          or creator_permissions_->test(all_permission_id)
+          or (getDomainFromName(creator) == getDomainFromName(target_account)
+              and creator_permissions_->test(domain_permission_id));
+      return has_perm ? "SELECT TRUE AS perm" : "SELECT FALSE AS perm";
     }
 
     void PostgresQueryExecutorVisitor::setQueryHash(
@@ -8,9 +8,11 @@
 
 #include "ametsuchi/query_executor.hpp"
 
+#include "ametsuchi/impl/block_file_format.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/storage.hpp"
+#include "ametsuchi/wsv_query.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
 #include "interfaces/commands/add_signatory.hpp"
@@ -58,11 +60,27 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
+          std::shared_ptr<WsvQuery> wsv_query = nullptr,
           logger::Logger log = logger::log("PostgresQueryExecutorVisitor"));
 
+      /**
+       * Set creator of the executed query, permissions of the creator are
+       * loaded through wsv query if it is provided
+       * @param creator_id - id of the query creator
+       */
       void setCreatorId(
           const shared_model::interface::types::AccountIdType &creator_id);
 
+      /**
+       * Generate an SQL subquery which checks if creator has the permission
+       * @param permission - permission to check
+       * @param account_alias - name of the parameter with creator id
+       * @return SQL subquery with a single perm column
+       */
+      std::string checkAccountRolePermission(
+          shared_model::interface::permissions::Role permission,
+          const std::string &account_alias = "role_account_id") const;
+
       void setQueryHash(const shared_model::crypto::Hash &query_hash);
 
       QueryExecutorResult operator()(
@@ -184,6 +202,19 @@ namespace iroha {
        *
        * @throws if check query finishes with an exception
        */
+      /**
+       * Generate an SQL subquery which checks if creator has corresponding
+       * permissions for target account
+       * @return SQL subquery with a single perm column
+       */
+      std::string hasQueryPermission(
+          const shared_model::interface::types::AccountIdType &creator,
+          const shared_model::interface::types::AccountIdType &target_account,
+          shared_model::interface::permissions::Role indiv_permission_id,
+          shared_model::interface::permissions::Role all_permission_id,
+          shared_model::interface::permissions::Role domain_permission_id)
+          const;
+
       template <typename ReturnValueType>
       bool existsInDb(const std::string &table_name,
                       const std::string &key_name,
@@ -216,11 +247,15 @@ namespace iroha {
       shared_model::interface::types::AccountIdType creator_id_;
       shared_model::interface::types::HashType query_hash_;
       std::shared_ptr<PendingTransactionStorage> pending_txs_storage_;
-      std::shared_ptr<shared_model::interface::BlockJsonConverter> converter_;
+      BlockFileFormat block_format_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           query_response_factory_;
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
+      std::shared_ptr<WsvQuery> wsv_query_;
+      /// permissions of the query creator, none if they are checked in SQL
+      boost::optional<shared_model::interface::RolePermissionSet>
+          creator_permissions_;
       logger::Logger log_;
     };
 
@@ -236,6 +271,7 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
+          std::shared_ptr<WsvQuery> wsv_query = nullptr,
           logger::Logger log = logger::log("PostgresQueryExecutor"));
 
       QueryExecutorResult validateAndExecute(
@@ -0,0 +1,461 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <ciso646>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/mapped_bytes_view.hpp"
+#include "common/byteutils.hpp"
+#include "common/files.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentedLog::Identifier;
+
+namespace {
+  const std::string kSegmentExtension = ".log";
+  const std::string kIndexExtension = ".idx";
+  /// offset (8) and size (4) of a record
+  constexpr size_t kIndexEntrySize = 12;
+
+  bool readFully(int fd, uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto res = ::pread(fd, data, size, offset);
+      if (res < 0 and errno == EINTR) {
+        continue;
+      }
+      if (res <= 0) {
+        return false;
+      }
+      data += res;
+      size -= res;
+      offset += res;
+    }
+    return true;
+  }
+
+  bool writeFully(int fd, const uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto res = ::pwrite(fd, data, size, offset);
+      if (res < 0 and errno == EINTR) {
+        continue;
+      }
+      if (res <= 0) {
+        return false;
+      }
+      data += res;
+      size -= res;
+      offset += res;
+    }
+    return true;
+  }
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  /**
+   * Flush directory entry changes, so that created and renamed files survive
+   * a crash
+   */
+  void syncDirectory(const std::string &dir) {
+    auto fd = ::open(dir.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+      ::fsync(fd);
+      ::close(fd);
+    }
+  }
+
+  boost::filesystem::path indexPath(const boost::filesystem::path &segment) {
+    auto path = segment;
+    return path.replace_extension(kIndexExtension);
+  }
+}  // namespace
+
+// ----------| public API |----------
+
+constexpr uint64_t SegmentedLog::kDefaultSegmentSize;
+constexpr size_t SegmentedLog::kDefaultSyncInterval;
+constexpr size_t SegmentedLog::kRecordHeaderSize;
+
+std::string SegmentedLog::segment_name(Identifier id) {
+  std::ostringstream os;
+  os << std::setw(16) << std::setfill('0') << id << kSegmentExtension;
+  return os.str();
+}
+
+boost::optional<std::unique_ptr<SegmentedLog>> SegmentedLog::create(
+    const std::string &path, uint64_t segment_size, size_t sync_interval) {
+  auto log_ = logger::log("SegmentedLog::create()");
+
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    log_->error("Cannot create storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+
+  auto storage = std::make_unique<SegmentedLog>(
+      path, segment_size, sync_interval, private_tag{});
+  if (not storage->recover()) {
+    return boost::none;
+  }
+  return boost::make_optional(std::move(storage));
+}
+
+bool SegmentedLog::add(Identifier id, const Bytes &blob) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  if (id != current_id_ + 1) {
+    log_->warn("Cannot append non-consecutive block");
+    return false;
+  }
+
+  const auto record_size = kRecordHeaderSize + blob.size();
+  if (segments_.empty()
+      or (segments_.back().size != 0
+          and segments_.back().size + record_size > segment_size_)) {
+    if (not rollSegment(id)) {
+      return false;
+    }
+  }
+
+  auto &segment = segments_.back();
+  uint8_t header[kRecordHeaderSize];
+  writeLittleEndian<uint32_t>(header, id);
+  writeLittleEndian<uint32_t>(header + 4, blob.size());
+  writeLittleEndian<uint32_t>(header + 8, checksum(blob.data(), blob.size()));
+
+  if (not writeFully(segment.fd, header, kRecordHeaderSize, segment.size)
+      or not writeFully(segment.fd,
+                        blob.data(),
+                        blob.size(),
+                        segment.size + kRecordHeaderSize)) {
+    log_->warn("Cannot write record {}: {}", id, std::strerror(errno));
+    // drop partially written record
+    if (::ftruncate(segment.fd, segment.size) != 0) {
+      log_->error("Cannot truncate segment {}", segment.first_id);
+    }
+    return false;
+  }
+
+  index_.push_back(Location{segments_.size() - 1,
+                            segment.size,
+                            static_cast<uint32_t>(blob.size())});
+  segment.size += record_size;
+  current_id_ = id;
+
+  if (++unsynced_records_ >= sync_interval_) {
+    flush();
+  }
+  return true;
+}
+
+boost::optional<SegmentedLog::Bytes> SegmentedLog::get(Identifier id) const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  if (id == 0 or id > index_.size()) {
+    log_->info("get({}) record not found", id);
+    return boost::none;
+  }
+
+  const auto &location = index_[id - 1];
+  Bytes buf(location.size);
+  if (not readFully(segments_[location.segment].fd,
+                    buf.data(),
+                    buf.size(),
+                    location.offset + kRecordHeaderSize)) {
+    log_->info("get({}) problem with reading segment", id);
+    return boost::none;
+  }
+  return buf;
+}
+
+boost::optional<std::unique_ptr<SegmentedLog::BytesView>>
+SegmentedLog::getView(Identifier id) const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  if (id == 0 or id > index_.size()) {
+    log_->info("getView({}) record not found", id);
+    return boost::none;
+  }
+
+  const auto &location = index_[id - 1];
+  auto view = MappedBytesView::create(segments_[location.segment].fd,
+                                      location.offset + kRecordHeaderSize,
+                                      location.size);
+  if (not view) {
+    log_->info("getView({}) problem with mapping segment", id);
+  }
+  return view;
+}
+
+std::string SegmentedLog::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentedLog::last_id() const {
+  return current_id_.load();
+}
+
+void SegmentedLog::dropAll() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  closeSegments();
+  iroha::remove_dir_contents(dump_dir_);
+  index_.clear();
+  unsynced_records_ = 0;
+  current_id_.store(0);
+}
+
+bool SegmentedLog::sync() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  return flush();
+}
+
+// ----------| private API |----------
+
+SegmentedLog::SegmentedLog(const std::string &path,
+                           uint64_t segment_size,
+                           size_t sync_interval,
+                           SegmentedLog::private_tag,
+                           logger::Logger log)
+    : dump_dir_(path),
+      segment_size_(segment_size),
+      sync_interval_(std::max<size_t>(sync_interval, 1)),
+      current_id_(0),
+      unsynced_records_(0),
+      log_{std::move(log)} {}
+
+SegmentedLog::~SegmentedLog() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  flush();
+  closeSegments();
+}
+
+bool SegmentedLog::recover() {
+  std::vector<boost::filesystem::path> files;
+  for (auto it = boost::filesystem::directory_iterator{dump_dir_};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    const auto stem = it->path().stem().string();
+    if (it->path().extension() == kSegmentExtension and not stem.empty()
+        and boost::algorithm::all(stem, boost::algorithm::is_digit())) {
+      files.push_back(it->path());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  for (auto file = files.begin(); file != files.end(); ++file) {
+    const Identifier first_id = std::stoul(file->stem().string());
+    if (first_id != current_id_ + 1) {
+      log_->warn("Segment {} does not follow record {}, dropping the rest",
+                 file->filename().string(),
+                 current_id_.load());
+      std::for_each(file, files.end(), [](const auto &p) {
+        boost::filesystem::remove(p);
+        boost::filesystem::remove(indexPath(p));
+      });
+      break;
+    }
+
+    auto fd = ::open(file->c_str(), O_RDWR | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 or ::fstat(fd, &st) != 0) {
+      log_->error("Cannot open segment {}", file->string());
+      return false;
+    }
+    segments_.push_back(
+        Segment{first_id, fd, static_cast<uint64_t>(st.st_size)});
+
+    const auto number = segments_.size() - 1;
+    const bool is_last = std::next(file) == files.end();
+    if (is_last or not loadIndex(number)) {
+      if (not scanSegment(number)) {
+        return false;
+      }
+      if (not is_last) {
+        writeIndex(number);
+      }
+    }
+    current_id_ = index_.size();
+  }
+  return true;
+}
+
+bool SegmentedLog::loadIndex(size_t segment_number) {
+  const auto &segment = segments_[segment_number];
+  const auto path = indexPath(boost::filesystem::path{dump_dir_}
+                              / segment_name(segment.first_id));
+
+  boost::system::error_code err;
+  const auto file_size = boost::filesystem::file_size(path, err);
+  if (err or file_size == 0 or file_size % kIndexEntrySize != 0) {
+    return false;
+  }
+
+  Bytes entries(file_size);
+  auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  const bool read = readFully(fd, entries.data(), entries.size(), 0);
+  ::close(fd);
+  if (not read) {
+    return false;
+  }
+
+  // records must be contiguous and cover the whole segment
+  std::vector<Location> locations;
+  uint64_t expected_offset = 0;
+  for (size_t i = 0; i < entries.size(); i += kIndexEntrySize) {
+    Location location{segment_number,
+                      readLittleEndian<uint64_t>(entries.data() + i),
+                      readLittleEndian<uint32_t>(entries.data() + i + 8)};
+    if (location.offset != expected_offset) {
+      return false;
+    }
+    expected_offset += kRecordHeaderSize + location.size;
+    locations.push_back(location);
+  }
+  if (expected_offset != segment.size) {
+    return false;
+  }
+
+  index_.insert(index_.end(), locations.begin(), locations.end());
+  return true;
+}
+
+bool SegmentedLog::scanSegment(size_t segment_number) {
+  auto &segment = segments_[segment_number];
+  uint64_t offset = 0;
+  uint8_t header[kRecordHeaderSize];
+  Bytes payload;
+
+  while (offset + kRecordHeaderSize <= segment.size) {
+    if (not readFully(segment.fd, header, kRecordHeaderSize, offset)) {
+      break;
+    }
+    const auto id = readLittleEndian<uint32_t>(header);
+    const auto size = readLittleEndian<uint32_t>(header + 4);
+    const auto crc = readLittleEndian<uint32_t>(header + 8);
+    if (id != index_.size() + 1
+        or offset + kRecordHeaderSize + size > segment.size) {
+      break;
+    }
+    payload.resize(size);
+    if (not readFully(
+            segment.fd, payload.data(), size, offset + kRecordHeaderSize)
+        or checksum(payload.data(), size) != crc) {
+      break;
+    }
+    index_.push_back(Location{segment_number, offset, size});
+    offset += kRecordHeaderSize + size;
+  }
+
+  if (offset != segment.size) {
+    log_->warn("Truncating segment {} from {} to {} bytes",
+               segment.first_id,
+               segment.size,
+               offset);
+    if (::ftruncate(segment.fd, offset) != 0 or ::fsync(segment.fd) != 0) {
+      log_->error("Cannot truncate segment {}", segment.first_id);
+      return false;
+    }
+    segment.size = offset;
+  }
+  return true;
+}
+
+bool SegmentedLog::rollSegment(Identifier first_id) {
+  if (not segments_.empty()) {
+    if (not flush() or not writeIndex(segments_.size() - 1)) {
+      log_->error("Cannot seal segment {}", segments_.back().first_id);
+      return false;
+    }
+  }
+
+  const auto path =
+      boost::filesystem::path{dump_dir_} / segment_name(first_id);
+  auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    log_->warn("Cannot create segment {}: {}",
+               path.string(),
+               std::strerror(errno));
+    return false;
+  }
+  syncDirectory(dump_dir_);
+  segments_.push_back(Segment{first_id, fd, 0});
+  return true;
+}
+
+bool SegmentedLog::writeIndex(size_t segment_number) const {
+  const auto &segment = segments_[segment_number];
+  const auto begin = index_.begin() + (segment.first_id - 1);
+  const auto end = segment_number + 1 < segments_.size()
+      ? index_.begin() + (segments_[segment_number + 1].first_id - 1)
+      : index_.end();
+
+  Bytes entries;
+  entries.reserve(std::distance(begin, end) * kIndexEntrySize);
+  for (auto it = begin; it != end; ++it) {
+    uint8_t entry[kIndexEntrySize];
+    writeLittleEndian<uint64_t>(entry, it->offset);
+    writeLittleEndian<uint32_t>(entry + 8, it->size);
+    entries.insert(entries.end(), entry, entry + kIndexEntrySize);
+  }
+
+  const auto path = indexPath(boost::filesystem::path{dump_dir_}
+                              / segment_name(segment.first_id));
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+  auto fd =
+      ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  const bool written = writeFully(fd, entries.data(), entries.size(), 0)
+      and ::fsync(fd) == 0;
+  ::close(fd);
+
+  boost::system::error_code err;
+  if (written) {
+    boost::filesystem::rename(tmp_path, path, err);
+  }
+  return written and not err;
+}
+
+bool SegmentedLog::flush() {
+  if (segments_.empty() or unsynced_records_ == 0) {
+    return true;
+  }
+  if (::fdatasync(segments_.back().fd) != 0) {
+    log_->error("Cannot sync segment {}: {}",
+                segments_.back().first_id,
+                std::strerror(errno));
+    return false;
+  }
+  unsynced_records_ = 0;
+  return true;
+}
+
+void SegmentedLog::closeSegments() {
+  for (auto &segment : segments_) {
+    ::close(segment.fd);
+  }
+  segments_.clear();
+}
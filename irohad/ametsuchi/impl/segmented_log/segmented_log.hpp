@@ -0,0 +1,196 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_LOG_HPP
+#define IROHA_SEGMENTED_LOG_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Solid storage which appends records into large segment files.
+     *
+     * Each record is a header (id, payload size and crc32 of the payload,
+     * all 4-byte little-endian) followed by the payload. A segment is named
+     * after the id of its first record. When the active segment exceeds
+     * segment size, it is sealed: an index file with offsets of its records
+     * is written next to it, and a new segment is started.
+     *
+     * On startup sealed segments are loaded from their index files, and the
+     * active segment is scanned. A torn or corrupted tail of the active
+     * segment is truncated.
+     */
+    class SegmentedLog : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+     public:
+      // ----------| public API |----------
+
+      static constexpr uint64_t kDefaultSegmentSize = 256 * 1024 * 1024;
+      static constexpr size_t kDefaultSyncInterval = 32;
+      static constexpr size_t kRecordHeaderSize = 12;
+
+      /**
+       * Convert id of the first record to the segment file name
+       * @param id - first record of the segment
+       * @return name of the segment file
+       */
+      static std::string segment_name(Identifier id);
+
+      /**
+       * Create storage in path
+       * @param path - target path for creating
+       * @param segment_size - size after which the active segment is sealed
+       * @param sync_interval - number of appended records after which
+       * segment is flushed to disk
+       * @return created storage
+       */
+      static boost::optional<std::unique_ptr<SegmentedLog>> create(
+          const std::string &path,
+          uint64_t segment_size = kDefaultSegmentSize,
+          size_t sync_interval = kDefaultSyncInterval);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      boost::optional<std::unique_ptr<BytesView>> getView(
+          Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      /**
+       * Flush appended records of the active segment to disk
+       * @return true if records are flushed
+       */
+      bool sync();
+
+      // ----------| modify operations |----------
+
+      SegmentedLog(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog(SegmentedLog &&rhs) = delete;
+
+      SegmentedLog &operator=(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog &operator=(SegmentedLog &&rhs) = delete;
+
+      // ----------| private API |----------
+
+      /**
+       * Create storage in path. Storage is empty until recover() is called
+       * @param path - folder of storage
+       * @param segment_size - size after which the active segment is sealed
+       * @param sync_interval - number of records between flushes
+       * @param log to print progress
+       */
+      SegmentedLog(const std::string &path,
+                   uint64_t segment_size,
+                   size_t sync_interval,
+                   SegmentedLog::private_tag,
+                   logger::Logger log = logger::log("SegmentedLog"));
+
+      ~SegmentedLog() override;
+
+     private:
+      struct Segment {
+        Identifier first_id;
+        int fd;
+        uint64_t size;
+      };
+
+      struct Location {
+        size_t segment;
+        uint64_t offset;
+        uint32_t size;
+      };
+
+      /**
+       * Load segments from the storage folder and restore the record index
+       * @return true if storage is usable
+       */
+      bool recover();
+
+      /**
+       * Load record locations of a sealed segment from its index file
+       * @return true if index file is present and consistent with segment
+       */
+      bool loadIndex(size_t segment_number);
+
+      /**
+       * Read record headers of a segment, verify checksums and truncate
+       * everything after the last valid record
+       * @return true if segment was read
+       */
+      bool scanSegment(size_t segment_number);
+
+      /**
+       * Write index file of the active segment and start a new one
+       * @param first_id - id of the first record in the new segment
+       * @return true if new segment is opened
+       */
+      bool rollSegment(Identifier first_id);
+
+      /**
+       * Write index file for a sealed segment
+       * @return true if index file is written
+       */
+      bool writeIndex(size_t segment_number) const;
+
+      /**
+       * Flush the active segment, must be called under exclusive lock
+       * @return true if records are flushed
+       */
+      bool flush();
+
+      void closeSegments();
+
+      /**
+       * Folder of storage
+       */
+      const std::string dump_dir_;
+
+      const uint64_t segment_size_;
+
+      const size_t sync_interval_;
+
+      /**
+       * Last written key
+       */
+      std::atomic<Identifier> current_id_;
+
+      std::vector<Segment> segments_;
+
+      /**
+       * Location of record with id i is stored at i - 1
+       */
+      std::vector<Location> index_;
+
+      size_t unsynced_records_;
+
+      mutable std::shared_timed_mutex mutex_;
+
+      logger::Logger log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_LOG_HPP
@@ -6,6 +6,8 @@
 #ifndef IROHA_POSTGRES_WSV_COMMON_HPP
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
+#include <string>
+
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
@@ -155,6 +157,40 @@ namespace iroha {
       };
     }
 
+    /// quote value as an element of postgres array literal
+    inline std::string quoteArrayElement(const std::string &value) {
+      std::string result = "\"";
+      for (auto c : value) {
+        if (c == '"' or c == '\\') {
+          result += '\\';
+        }
+        result += c;
+      }
+      return result + "\"";
+    }
+
+    inline std::string quoteArrayElement(size_t value) {
+      return std::to_string(value);
+    }
+
+    inline std::string quoteArrayElement(bool value) {
+      return value ? "t" : "f";
+    }
+
+    /// make postgres array literal from a column of values, which is passed
+    /// as a single query parameter and unnested on the server side
+    template <typename Column>
+    std::string makeArray(const Column &column) {
+      std::string result = "{";
+      for (const auto &value : column) {
+        if (result.size() > 1) {
+          result += ',';
+        }
+        result += quoteArrayElement(value);
+      }
+      return result + "}";
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
 
@@ -6,7 +6,10 @@
 #include "ametsuchi/impl/storage_impl.hpp"
 
 #include <soci/postgresql/soci-postgresql.h>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/format.hpp>
+#include <boost/range/size.hpp>
+#include "ametsuchi/impl/cached_wsv_query.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
@@ -15,7 +18,9 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
 #include "common/byteutils.hpp"
@@ -50,11 +55,14 @@ namespace iroha {
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
+    const std::string kSegmentedLogPrefix = "segmented:";
 
     ConnectionContext::ConnectionContext(
         std::unique_ptr<KeyValueStorage> block_store)
         : block_store(std::move(block_store)) {}
 
+    constexpr size_t StorageImpl::kDefaultPoolSize;
+
     StorageImpl::StorageImpl(
         std::string block_store_dir,
         PostgresOptions postgres_options,
@@ -73,7 +81,10 @@ namespace iroha {
           connection_(std::move(connection)),
           factory_(std::move(factory)),
           converter_(std::move(converter)),
+          block_format_(converter_),
           perm_converter_(std::move(perm_converter)),
+          wsv_cache_(std::make_shared<WsvCache>()),
+          batch_commands_(false),
           log_(std::move(log)),
           pool_size_(pool_size),
           prepared_blocks_enabled_(enable_prepared_blocks),
@@ -101,10 +112,20 @@ namespace iroha {
         return expected::makeError("Connection was closed");
       }
       auto sql = std::make_unique<soci::session>(*connection_);
+      // new validation starts when the round of the prepared state is over,
+      // and the state holds row locks which would block the validation
+      if (block_is_prepared) {
+        rollbackPrepared(*sql);
+      }
 
       return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
           std::make_unique<TemporaryWsvImpl>(
-              std::move(sql), factory_, perm_converter_));
+              std::move(sql),
+              factory_,
+              perm_converter_,
+              wsv_cache_,
+              hot_assets_,
+              batch_commands_));
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
@@ -189,7 +210,11 @@ namespace iroha {
               std::move(pending_txs_storage),
               converter_,
               std::move(response_factory),
-              perm_converter_));
+              perm_converter_,
+              std::make_shared<CachedWsvQuery>(
+                  std::make_shared<PostgresWsvQuery>(
+                      std::make_unique<soci::session>(*connection_), factory_),
+                  wsv_cache_)));
     }
 
     bool StorageImpl::insertBlock(const shared_model::interface::Block &block) {
@@ -242,6 +267,7 @@ namespace iroha {
           rollbackPrepared(sql);
         }
         sql << reset_;
+        wsv_cache_->clear();
         log_->info("drop blocks from disk");
         block_store_->dropAll();
       } catch (std::exception &e) {
@@ -273,6 +299,8 @@ namespace iroha {
         soci::session(*connection_) << drop_;
       }
 
+      wsv_cache_->clear();
+
       // erase blocks
       log_->info("drop block store");
       block_store_->dropAll();
@@ -330,7 +358,16 @@ namespace iroha {
       auto log_ = logger::log("StorageImpl:initConnection");
       log_->info("Start storage creation");
 
-      auto block_store = FlatFile::create(block_store_dir);
+      std::unique_ptr<KeyValueStorage> block_store;
+      if (boost::starts_with(block_store_dir, kSegmentedLogPrefix)) {
+        auto path = block_store_dir.substr(kSegmentedLogPrefix.size());
+        if (auto segmented_log = SegmentedLog::create(path)) {
+          block_store = std::move(*segmented_log);
+        }
+      } else if (auto flat_file = FlatFile::create(block_store_dir)) {
+        block_store = std::move(*flat_file);
+      }
+
       if (not block_store) {
         return expected::makeError(
             (boost::format("Cannot create block store in %s") % block_store_dir)
@@ -338,7 +375,7 @@ namespace iroha {
       }
       log_->info("block store created");
 
-      return expected::makeValue(ConnectionContext(std::move(*block_store)));
+      return expected::makeValue(ConnectionContext(std::move(block_store)));
     }
 
     expected::Result<std::shared_ptr<soci::connection_pool>, std::string>
@@ -420,6 +457,11 @@ namespace iroha {
       try {
         *(storage->sql_) << "COMMIT";
         storage->committed = true;
+        // values loaded before the commit are from the old state, so entries
+        // are dropped only after it
+        for (const auto &block : storage->block_store_) {
+          invalidateCache(*block.second);
+        }
       } catch (std::exception &e) {
         storage->committed = false;
         log_->warn("Mutable storage is not committed. Reason: {}", e.what());
@@ -428,15 +470,16 @@ namespace iroha {
 
     bool StorageImpl::commitPrepared(
         const shared_model::interface::Block &block) {
-      if (not prepared_blocks_enabled_) {
-        log_->warn("prepared blocks are not enabled");
-        return false;
-      }
-
+      std::lock_guard<std::mutex> prepared_lock(prepared_mutex_);
       if (not block_is_prepared) {
         log_->info("there are no prepared blocks");
         return false;
       }
+      if (not matchesPrepared(block)) {
+        log_->info("prepared state does not match block {}",
+                   block.hash().hex());
+        return false;
+      }
       log_->info("applying prepared block");
 
       try {
@@ -445,10 +488,21 @@ namespace iroha {
           log_->info("connection to database is not initialised");
           return false;
         }
-        soci::session sql(*connection_);
-        sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
-        PostgresBlockIndex block_index(sql);
-        block_index.index(block);
+        if (prepared_wsv_) {
+          // changes are still in the open transaction of temporary wsv
+          auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*prepared_wsv_);
+          soci::session &sql = *wsv_impl.sql_;
+          PostgresBlockIndex block_index(sql);
+          block_index.index(block);
+          sql << "COMMIT";
+          wsv_impl.committed_ = true;
+          prepared_wsv_.reset();
+        } else {
+          soci::session sql(*connection_);
+          sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+          PostgresBlockIndex block_index(sql);
+          block_index.index(block);
+        }
         block_is_prepared = false;
       } catch (const std::exception &e) {
         log_->warn("failed to apply prepared block {}: {}",
@@ -457,17 +511,32 @@ namespace iroha {
         return false;
       }
 
+      invalidateCache(block);
       return storeBlock(block);
     }
 
+    bool StorageImpl::matchesPrepared(
+        const shared_model::interface::Block &block) const {
+      const auto &txs = block.transactions();
+      return boost::size(txs) == prepared_tx_hashes_.size()
+          and std::equal(prepared_tx_hashes_.begin(),
+                         prepared_tx_hashes_.end(),
+                         txs.begin(),
+                         [](const auto &hash, const auto &tx) {
+                           return hash == tx.hash();
+                         });
+    }
+
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
       if (not connection_) {
         log_->info("connection to database is not initialised");
         return nullptr;
       }
-      return std::make_shared<PostgresWsvQuery>(
-          std::make_unique<soci::session>(*connection_), factory_);
+      return std::make_shared<CachedWsvQuery>(
+          std::make_shared<PostgresWsvQuery>(
+              std::make_unique<soci::session>(*connection_), factory_),
+          wsv_cache_);
     }
 
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
@@ -482,6 +551,20 @@ namespace iroha {
           converter_);
     }
 
+    std::shared_ptr<WsvCache> StorageImpl::wsvCache() const {
+      return wsv_cache_;
+    }
+
+    void StorageImpl::setHotAssets(
+        std::unordered_set<shared_model::interface::types::AssetIdType>
+            hot_assets) {
+      hot_assets_ = std::move(hot_assets);
+    }
+
+    void StorageImpl::setCommandBatching(bool batch_commands) {
+      batch_commands_ = batch_commands;
+    }
+
     rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
     StorageImpl::on_commit() {
       return notifier_.get_observable();
@@ -489,21 +572,33 @@ namespace iroha {
 
     void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
       auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
-      if (not prepared_blocks_enabled_) {
-        log_->warn("prepared block are not enabled");
+      std::lock_guard<std::mutex> prepared_lock(prepared_mutex_);
+      if (block_is_prepared) {
         return;
       }
-      if (not block_is_prepared) {
+      if (not wsv_impl.flushBalances()) {
+        log_->warn("failed to write balances, state is not prepared");
+        return;
+      }
+      prepared_tx_hashes_ = wsv_impl.applied_tx_hashes_;
+      if (prepared_blocks_enabled_) {
         soci::session &sql = *wsv_impl.sql_;
         try {
           sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
           block_is_prepared = true;
+          log_->info("state prepared successfully");
+          return;
         } catch (const std::exception &e) {
           log_->warn("failed to prepare state: {}", e.what());
+          // transaction is aborted and cannot be kept open
+          return;
         }
-
-        log_->info("state prepared successfully");
       }
+      // keep the open transaction until the block is committed or another
+      // state is applied
+      prepared_wsv_ = std::move(wsv);
+      block_is_prepared = true;
+      log_->info("state kept in temporary wsv");
     }
 
     StorageImpl::~StorageImpl() {
@@ -511,6 +606,13 @@ namespace iroha {
     }
 
     void StorageImpl::rollbackPrepared(soci::session &sql) {
+      std::lock_guard<std::mutex> prepared_lock(prepared_mutex_);
+      if (prepared_wsv_) {
+        // destructor of temporary wsv rolls back its transaction
+        prepared_wsv_.reset();
+        block_is_prepared = false;
+        return;
+      }
       try {
         sql << "ROLLBACK PREPARED '" + prepared_block_name_ + "';";
         block_is_prepared = false;
@@ -520,10 +622,10 @@ namespace iroha {
     }
 
     bool StorageImpl::storeBlock(const shared_model::interface::Block &block) {
-      auto json_result = converter_->serialize(block);
-      return json_result.match(
-          [this, &block](const expected::Value<std::string> &v) {
-            block_store_->add(block.height(), stringToBytes(v.value));
+      auto serialized = block_format_.serialize(block);
+      return serialized.match(
+          [this, &block](const expected::Value<KeyValueStorage::Bytes> &v) {
+            block_store_->add(block.height(), v.value);
             notifier_.get_subscriber().on_next(clone(block));
             return true;
           },
@@ -533,6 +635,14 @@ namespace iroha {
           });
     }
 
+    void StorageImpl::invalidateCache(
+        const shared_model::interface::Block &block) {
+      wsv_cache_->invalidate(block);
+      log_->debug("wsv cache hits: {}, misses: {}",
+                  wsv_cache_->hits(),
+                  wsv_cache_->misses());
+    }
+
     const std::string &StorageImpl::drop_ = R"(
 DROP TABLE IF EXISTS account_has_signatory;
 DROP TABLE IF EXISTS account_has_asset;
@@ -545,7 +655,7 @@ DROP TABLE IF EXISTS domain;
 DROP TABLE IF EXISTS signatory;
 DROP TABLE IF EXISTS peer;
 DROP TABLE IF EXISTS role;
-DROP TABLE IF EXISTS height_by_hash;
+DROP TABLE IF EXISTS position_by_hash;
 DROP TABLE IF EXISTS tx_status_by_hash;
 DROP TABLE IF EXISTS height_by_account_set;
 DROP TABLE IF EXISTS index_by_creator_height;
@@ -569,6 +679,67 @@ DELETE FROM tx_status_by_hash;
 DELETE FROM height_by_account_set;
 DELETE FROM index_by_creator_height;
 DELETE FROM position_by_account_asset;
+)";
+
+    const std::string &StorageImpl::migrate_ = R"(
+DO $$
+BEGIN
+IF EXISTS (SELECT 1 FROM information_schema.columns
+           WHERE table_name = 'position_by_hash'
+           AND column_name = 'height' AND data_type = 'text') THEN
+    DELETE FROM position_by_hash a USING position_by_hash b
+        WHERE a.ctid < b.ctid AND a.hash = b.hash;
+    ALTER TABLE position_by_hash
+        ALTER COLUMN hash SET NOT NULL,
+        ALTER COLUMN height TYPE bigint USING height::bigint,
+        ALTER COLUMN height SET NOT NULL,
+        ALTER COLUMN index TYPE bigint USING index::bigint,
+        ALTER COLUMN index SET NOT NULL,
+        ADD PRIMARY KEY (hash);
+
+    DELETE FROM tx_status_by_hash a USING tx_status_by_hash b
+        WHERE a.ctid < b.ctid AND a.hash = b.hash;
+    ALTER TABLE tx_status_by_hash
+        ALTER COLUMN hash SET NOT NULL,
+        ALTER COLUMN status SET NOT NULL,
+        ADD PRIMARY KEY (hash);
+
+    DELETE FROM height_by_account_set a USING height_by_account_set b
+        WHERE a.ctid < b.ctid AND a.account_id = b.account_id
+        AND a.height = b.height;
+    ALTER TABLE height_by_account_set
+        ALTER COLUMN account_id SET NOT NULL,
+        ALTER COLUMN height TYPE bigint USING height::bigint,
+        ALTER COLUMN height SET NOT NULL,
+        ADD PRIMARY KEY (account_id, height);
+
+    DELETE FROM index_by_creator_height a USING index_by_creator_height b
+        WHERE a.ctid < b.ctid AND a.creator_id = b.creator_id
+        AND a.height = b.height AND a.index = b.index;
+    ALTER TABLE index_by_creator_height
+        DROP COLUMN IF EXISTS id,
+        ALTER COLUMN creator_id SET NOT NULL,
+        ALTER COLUMN height TYPE bigint USING height::bigint,
+        ALTER COLUMN height SET NOT NULL,
+        ALTER COLUMN index TYPE bigint USING index::bigint,
+        ALTER COLUMN index SET NOT NULL,
+        ADD PRIMARY KEY (creator_id, height, index);
+
+    DELETE FROM position_by_account_asset a USING position_by_account_asset b
+        WHERE a.ctid < b.ctid AND a.account_id = b.account_id
+        AND a.asset_id = b.asset_id AND a.height = b.height
+        AND a.index = b.index;
+    ALTER TABLE position_by_account_asset
+        ALTER COLUMN account_id SET NOT NULL,
+        ALTER COLUMN asset_id SET NOT NULL,
+        ALTER COLUMN height TYPE bigint USING height::bigint,
+        ALTER COLUMN height SET NOT NULL,
+        ALTER COLUMN index TYPE bigint USING index::bigint,
+        ALTER COLUMN index SET NOT NULL,
+        ADD PRIMARY KEY (account_id, asset_id, height, index);
+END IF;
+END
+$$;
 )";
 
     const std::string &StorageImpl::init_ =
@@ -638,32 +809,38 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
     PRIMARY KEY (permittee_account_id, account_id)
 );
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
-    height text,
-    index text
+    hash varchar NOT NULL,
+    height bigint NOT NULL,
+    index bigint NOT NULL,
+    PRIMARY KEY (hash)
 );
-
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
-    status boolean
+    hash varchar NOT NULL,
+    status boolean NOT NULL,
+    PRIMARY KEY (hash)
 );
-
 CREATE TABLE IF NOT EXISTS height_by_account_set (
-    account_id text,
-    height text
+    account_id text NOT NULL,
+    height bigint NOT NULL,
+    PRIMARY KEY (account_id, height)
 );
 CREATE TABLE IF NOT EXISTS index_by_creator_height (
-    id serial,
-    creator_id text,
-    height text,
-    index text
+    creator_id text NOT NULL,
+    height bigint NOT NULL,
+    index bigint NOT NULL,
+    PRIMARY KEY (creator_id, height, index)
 );
 CREATE TABLE IF NOT EXISTS position_by_account_asset (
-    account_id text,
-    asset_id text,
-    height text,
-    index text
+    account_id text NOT NULL,
+    asset_id text NOT NULL,
+    height bigint NOT NULL,
+    index bigint NOT NULL,
+    PRIMARY KEY (account_id, asset_id, height, index)
 );
+)"
+        + migrate_ + R"(
+CREATE INDEX IF NOT EXISTS position_by_hash_height_index_idx
+    ON position_by_hash (height, index);
 )";
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -10,11 +10,14 @@
 
 #include <atomic>
 #include <cmath>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 
+#include "ametsuchi/impl/block_file_format.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
@@ -26,6 +29,7 @@ namespace iroha {
   namespace ametsuchi {
 
     class FlatFile;
+    class WsvCache;
 
     struct ConnectionContext {
       explicit ConnectionContext(std::unique_ptr<KeyValueStorage> block_store);
@@ -39,6 +43,11 @@ namespace iroha {
           const std::string &dbname,
           const std::string &options_str_without_dbname);
 
+      /**
+       * Create block store. Path prefixed with "segmented:" selects
+       * SegmentedLog, any other path selects FlatFile
+       * @param block_store_dir - block store path from the configuration
+       */
       static expected::Result<ConnectionContext, std::string> initConnections(
           std::string block_store_dir);
 
@@ -47,6 +56,9 @@ namespace iroha {
       initPostgresConnection(std::string &options_str, size_t pool_size);
 
      public:
+      /// number of database connections in the pool by default
+      static constexpr size_t kDefaultPoolSize = 10;
+
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
           std::string block_store_dir,
           std::string postgres_connection,
@@ -56,7 +68,7 @@ namespace iroha {
               converter,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          size_t pool_size = 10);
+          size_t pool_size = kDefaultPoolSize);
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
@@ -108,6 +120,29 @@ namespace iroha {
 
       std::shared_ptr<BlockQuery> getBlockQuery() const override;
 
+      /**
+       * @return cache of the committed wsv, which exposes hit and miss counters
+       */
+      std::shared_ptr<WsvCache> wsvCache() const;
+
+      /**
+       * Keep balances of the given assets in memory while transactions are
+       * validated in temporary wsv, must be called before temporary wsvs are
+       * created
+       * @param hot_assets - assets with frequent transfers
+       */
+      void setHotAssets(
+          std::unordered_set<shared_model::interface::types::AssetIdType>
+              hot_assets);
+
+      /**
+       * Send commands of a transaction validated in temporary wsv to the
+       * database in a single round trip, must be called before temporary
+       * wsvs are created. Not used together with hot assets
+       * @param batch_commands - true to enable batching
+       */
+      void setCommandBatching(bool batch_commands);
+
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       on_commit() override;
 
@@ -144,11 +179,23 @@ namespace iroha {
        */
       void rollbackPrepared(soci::session &sql);
 
+      /**
+       * Check that prepared state was produced by transactions of the block
+       * @return true if transactions of the block match prepared ones
+       */
+      bool matchesPrepared(const shared_model::interface::Block &block) const;
+
       /**
        * add block to block storage
        */
       bool storeBlock(const shared_model::interface::Block &block);
 
+      /**
+       * Drop entries of the wsv cache changed by the block, must be called
+       * after the state of the block is committed to the database
+       */
+      void invalidateCache(const shared_model::interface::Block &block);
+
       std::unique_ptr<KeyValueStorage> block_store_;
 
       std::shared_ptr<soci::connection_pool> connection_;
@@ -160,9 +207,22 @@ namespace iroha {
 
       std::shared_ptr<shared_model::interface::BlockJsonConverter> converter_;
 
+      BlockFileFormat block_format_;
+
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      /**
+       * Cache of the committed wsv shared by wsv queries, query executors and
+       * temporary wsvs, invalidated on each stored block
+       */
+      std::shared_ptr<WsvCache> wsv_cache_;
+
+      std::unordered_set<shared_model::interface::types::AssetIdType>
+          hot_assets_;
+
+      bool batch_commands_;
+
       logger::Logger log_;
 
       mutable std::shared_timed_mutex drop_mutex;
@@ -175,9 +235,27 @@ namespace iroha {
 
       std::string prepared_block_name_;
 
+      /**
+       * Temporary wsv with uncommitted changes of the validated proposal, which
+       * is kept instead of prepared transaction when those are not available
+       */
+      std::unique_ptr<TemporaryWsv> prepared_wsv_;
+
+      /**
+       * Hashes of transactions applied to the prepared state
+       */
+      std::vector<shared_model::interface::types::HashType> prepared_tx_hashes_;
+
+      std::mutex prepared_mutex_;
+
      protected:
       static const std::string &drop_;
       static const std::string &reset_;
+      /**
+       * Converts block index tables created by older versions into typed
+       * columns with primary keys, must be run before indexes are created
+       */
+      static const std::string &migrate_;
       static const std::string &init_;
     };
   }  // namespace ametsuchi
@@ -7,10 +7,17 @@
 
 #include <boost/format.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
+#include "validation/utils.hpp"
+
+namespace {
+  /// savepoint which is rolled back if a transaction fails
+  const std::string kTransactionSavepoint = "savepoint_temp_wsv";
+}  // namespace
 
 namespace iroha {
   namespace ametsuchi {
@@ -19,17 +26,85 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
+        std::shared_ptr<WsvCache> cache,
+        std::unordered_set<shared_model::interface::types::AssetIdType>
+            hot_assets,
+        bool batch_commands,
         logger::Logger log)
         : sql_(std::move(sql)),
           command_executor_(std::make_unique<PostgresCommandExecutor>(
               *sql_, std::move(perm_converter))),
+          balance_executor_(nullptr),
+          batch_executor_(nullptr),
+          wsv_query_(
+              std::make_unique<PostgresWsvQuery>(*sql_, std::move(factory))),
+          cache_(std::move(cache)),
+          release_batch_savepoint_(false),
+          committed_(false),
           log_(std::move(log)) {
       *sql_ << "BEGIN";
+      if (not hot_assets.empty()) {
+        auto executor = std::make_unique<InMemoryBalanceExecutor>(
+            *sql_, std::move(command_executor_), std::move(hot_assets));
+        balance_executor_ = executor.get();
+        command_executor_ = std::move(executor);
+      } else if (batch_commands) {
+        batch_executor_ =
+            static_cast<PostgresCommandExecutor *>(command_executor_.get());
+      }
+    }
+
+    bool TemporaryWsvImpl::flushBalances() {
+      if (not balance_executor_) {
+        return true;
+      }
+      return balance_executor_->flush().match(
+          [](const expected::Value<void> &) { return true; },
+          [this](const expected::Error<std::string> &e) {
+            log_->error(e.error);
+            return false;
+          });
+    }
+
+    boost::optional<expected::Result<void, validation::CommandError>>
+    TemporaryWsvImpl::validateSignaturesCached(
+        const shared_model::interface::Transaction &transaction) {
+      const auto &creator = transaction.creatorAccountId();
+      if (not cache_ or changed_accounts_.count(creator) != 0) {
+        return boost::none;
+      }
+      // creator is not changed in this session, so it reads committed state
+      auto account = cache_->getAccount(
+          creator, [&] { return wsv_query_->getAccount(creator); });
+      auto signatories = cache_->getSignatories(
+          creator, [&] { return wsv_query_->getSignatories(creator); });
+      if (not account or not signatories) {
+        return boost::none;
+      }
+
+      if (boost::size(transaction.signatures()) >= (*account)->quorum()
+          and validation::signaturesSubset(transaction.signatures(),
+                                           *signatories)) {
+        return boost::make_optional<
+            expected::Result<void, validation::CommandError>>({});
+      }
+      auto error_str = "Transaction " + transaction.toString()
+          + " failed signatures validation";
+      // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+      // with named constant
+      return boost::make_optional<
+          expected::Result<void, validation::CommandError>>(
+          expected::makeError(validation::CommandError{
+              "signatures validation", 2, error_str, false}));
     }
 
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
+      if (auto result = validateSignaturesCached(transaction)) {
+        return *result;
+      }
+
       auto keys_range = transaction.signatures()
           | boost::adaptors::transformed(
                             [](const auto &s) { return s.publicKey().hex(); });
@@ -90,13 +165,20 @@ namespace iroha {
         return boost::apply_visitor(*command_executor_, command.get());
       };
 
-      auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
+      // batched transaction creates its savepoint in the same round trip
+      auto savepoint_wrapper = batch_executor_
+          ? nullptr
+          : createSavepoint(kTransactionSavepoint);
 
-      return validateSignatures(transaction) |
-                 [savepoint = std::move(savepoint_wrapper),
+      auto result = validateSignatures(transaction) |
+                 [this,
+                  savepoint = std::move(savepoint_wrapper),
                   &execute_command,
                   &transaction]()
                  -> expected::Result<void, validation::CommandError> {
+        if (not savepoint) {
+          return applyBatch(transaction);
+        }
         // check transaction's commands validity
         const auto &commands = transaction.commands();
         validation::CommandError cmd_error;
@@ -121,6 +203,107 @@ namespace iroha {
         savepoint->release();
         return {};
       };
+      if (not boost::get<expected::Error<validation::CommandError>>(&result)) {
+        markApplied(transaction);
+      }
+      return result;
+    }
+
+    void TemporaryWsvImpl::markApplied(
+        const shared_model::interface::Transaction &transaction) {
+      applied_tx_hashes_.push_back(transaction.hash());
+      for (const auto &command : transaction.commands()) {
+        if (auto account_id = WsvCache::changedAccount(command)) {
+          changed_accounts_.insert(*account_id);
+        }
+      }
+    }
+
+    expected::Result<void, std::string> TemporaryWsvImpl::applyValidated(
+        const std::vector<std::reference_wrapper<
+            const shared_model::interface::Transaction>> &transactions) {
+      auto savepoint = createSavepoint("savepoint_validated");
+      command_executor_->doValidation(false);
+
+      if (balance_executor_) {
+        // hot asset commands are executed in memory, others one by one
+        for (const auto &transaction : transactions) {
+          command_executor_->setCreatorAccountId(
+              transaction.get().creatorAccountId());
+          for (const auto &command : transaction.get().commands()) {
+            auto result =
+                boost::apply_visitor(*command_executor_, command.get());
+            if (auto error =
+                    boost::get<expected::Error<CommandError>>(&result)) {
+              return expected::makeError(error->error.toString());
+            }
+          }
+        }
+      } else {
+        // all commands are sent in a single round trip
+        auto &executor =
+            static_cast<PostgresCommandExecutor &>(*command_executor_);
+        executor.beginBatch();
+        for (const auto &transaction : transactions) {
+          executor.setCreatorAccountId(transaction.get().creatorAccountId());
+          for (const auto &command : transaction.get().commands()) {
+            boost::apply_visitor(executor, command.get());
+          }
+        }
+        auto result = executor.executeBatch();
+        if (auto error = boost::get<
+                expected::Error<std::pair<size_t, CommandError>>>(&result)) {
+          return expected::makeError(error->error.second.toString());
+        }
+      }
+
+      savepoint->release();
+      for (const auto &transaction : transactions) {
+        markApplied(transaction);
+      }
+      return {};
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::applyBatch(
+        const shared_model::interface::Transaction &transaction) {
+      batch_executor_->beginBatch();
+      for (const auto &command : transaction.commands()) {
+        boost::apply_visitor(*command_executor_, command.get());
+      }
+
+      // savepoint of the previous transaction is released in the same round
+      // trip, it is kept until now since commands of the batch can not be
+      // released conditionally
+      std::vector<std::string> prologue;
+      if (release_batch_savepoint_) {
+        prologue.push_back("RELEASE SAVEPOINT " + kTransactionSavepoint);
+      }
+      prologue.push_back("SAVEPOINT " + kTransactionSavepoint);
+      release_batch_savepoint_ = false;
+
+      return batch_executor_->executeBatch(prologue).match(
+          [this](const expected::Value<void> &)
+              -> expected::Result<void, validation::CommandError> {
+            release_batch_savepoint_ = true;
+            return {};
+          },
+          [this](const expected::Error<std::pair<size_t, CommandError>> &e)
+              -> expected::Result<void, validation::CommandError> {
+            try {
+              *sql_ << "ROLLBACK TO SAVEPOINT " + kTransactionSavepoint
+                      + ";RELEASE SAVEPOINT " + kTransactionSavepoint + ";";
+            } catch (std::exception &ex) {
+              log_->error("SQL error. Reason: {}", ex.what());
+            }
+            const auto &error = e.error.second;
+            return expected::makeError(
+                validation::CommandError{error.command_name,
+                                         error.error_code,
+                                         error.error_extra,
+                                         true,
+                                         e.error.first});
+          });
     }
 
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
@@ -130,6 +313,9 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::~TemporaryWsvImpl() {
+      if (committed_) {
+        return;
+      }
       try {
         *sql_ << "ROLLBACK";
       } catch (std::exception &e) {
@@ -138,13 +324,24 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
-        const iroha::ametsuchi::TemporaryWsvImpl &wsv,
+        iroha::ametsuchi::TemporaryWsvImpl &wsv,
         std::string savepoint_name)
         : sql_{*wsv.sql_},
+          applied_tx_hashes_{wsv.applied_tx_hashes_},
+          applied_txs_count_{wsv.applied_tx_hashes_.size()},
+          balance_executor_{wsv.balance_executor_},
+          balance_mark_{balance_executor_ ? balance_executor_->savepoint()
+                                          : 0},
+          release_batch_savepoint_{wsv.release_batch_savepoint_},
           savepoint_name_{std::move(savepoint_name)},
           is_released_{false},
           log_(logger::log("Temporary wsv's savepoint wrapper")) {
-      sql_ << "SAVEPOINT " + savepoint_name_ + ";";
+      std::string query = "SAVEPOINT " + savepoint_name_ + ";";
+      if (release_batch_savepoint_) {
+        query = "RELEASE SAVEPOINT " + kTransactionSavepoint + ";" + query;
+        release_batch_savepoint_ = false;
+      }
+      sql_ << query;
     }
 
     void TemporaryWsvImpl::SavepointWrapperImpl::release() {
@@ -155,9 +352,16 @@ namespace iroha {
       try {
         if (not is_released_) {
           sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
+          applied_tx_hashes_.resize(applied_txs_count_);
+          if (balance_executor_) {
+            balance_executor_->rollback(balance_mark_);
+          }
         } else {
           sql_ << "RELEASE SAVEPOINT " + savepoint_name_ + ";";
         }
+        // savepoints of batched transactions created after this one are
+        // released or rolled back together with it
+        release_batch_savepoint_ = false;
       } catch (std::exception &e) {
         log_->error("SQL error. Reason: {}", e.what());
       }
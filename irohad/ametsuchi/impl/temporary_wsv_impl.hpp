@@ -8,9 +8,16 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_set>
+
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/in_memory_balance_executor.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
+#include "ametsuchi/wsv_query.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 
 namespace shared_model {
@@ -27,7 +34,7 @@ namespace iroha {
 
      public:
       struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
-        SavepointWrapperImpl(const TemporaryWsvImpl &wsv,
+        SavepointWrapperImpl(TemporaryWsvImpl &wsv,
                              std::string savepoint_name);
 
         void release() override;
@@ -36,6 +43,12 @@ namespace iroha {
 
        private:
         soci::session &sql_;
+        std::vector<shared_model::interface::types::HashType>
+            &applied_tx_hashes_;
+        size_t applied_txs_count_;
+        InMemoryBalanceExecutor *balance_executor_;
+        size_t balance_mark_;
+        bool &release_batch_savepoint_;
         std::string savepoint_name_;
         bool is_released_;
         logger::Logger log_;
@@ -47,11 +60,20 @@ namespace iroha {
               factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
+          std::shared_ptr<WsvCache> cache = nullptr,
+          std::unordered_set<shared_model::interface::types::AssetIdType>
+              hot_assets = {},
+          bool batch_commands = false,
           logger::Logger log = logger::log("TemporaryWSV"));
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      expected::Result<void, std::string> applyValidated(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions)
+          override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
@@ -65,8 +87,67 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Verify signatures against signatories and quorum from the cache
+       * @return validation result, none if creator is not found in the cache
+       * or is changed by this temporary wsv
+       */
+      boost::optional<expected::Result<void, validation::CommandError>>
+      validateSignaturesCached(
+          const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Execute commands of the transaction in a single round trip together
+       * with the savepoint of the transaction
+       */
+      expected::Result<void, validation::CommandError> applyBatch(
+          const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Remember the transaction as applied to the session
+       */
+      void markApplied(const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Write balances of hot assets kept in memory to the session
+       * @return true if balances are written or there are no such balances
+       */
+      bool flushBalances();
+
       std::unique_ptr<soci::session> sql_;
       std::unique_ptr<CommandExecutor> command_executor_;
+      /// executor of hot asset commands, owned by command_executor_, null if
+      /// there are no hot assets
+      InMemoryBalanceExecutor *balance_executor_;
+      /// executor which collects commands of a transaction into a single
+      /// round trip, owned by command_executor_, null if batching is disabled
+      PostgresCommandExecutor *batch_executor_;
+      std::unique_ptr<WsvQuery> wsv_query_;
+      std::shared_ptr<WsvCache> cache_;
+
+      /**
+       * Accounts whose quorum or signatories may be changed by applied
+       * transactions, those are not served from the cache
+       */
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          changed_accounts_;
+
+      /**
+       * Hashes of transactions whose changes are kept in the session, in the
+       * order of application
+       */
+      std::vector<shared_model::interface::types::HashType> applied_tx_hashes_;
+
+      /**
+       * Set when the savepoint of the last batched transaction is kept open,
+       * it is released with the next statement sent to the session
+       */
+      bool release_batch_savepoint_;
+
+      /**
+       * Set when changes of the session are committed by the storage
+       */
+      bool committed_;
 
       logger::Logger log_;
     };
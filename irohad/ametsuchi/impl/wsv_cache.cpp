@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    WsvCache::WsvCache(size_t max_entries)
+        : max_entries_(max_entries), version_(0), hits_(0), misses_(0) {}
+
+    boost::optional<shared_model::interface::types::AccountIdType>
+    WsvCache::changedAccount(const shared_model::interface::Command &command) {
+      using ReturnType =
+          boost::optional<shared_model::interface::types::AccountIdType>;
+      return visit_in_place(
+          command.get(),
+          [](const shared_model::interface::CreateAccount &c) -> ReturnType {
+            return c.accountName() + "@" + c.domainId();
+          },
+          [](const shared_model::interface::SetQuorum &c) -> ReturnType {
+            return c.accountId();
+          },
+          [](const shared_model::interface::SetAccountDetail &c)
+              -> ReturnType { return c.accountId(); },
+          [](const shared_model::interface::AddSignatory &c) -> ReturnType {
+            return c.accountId();
+          },
+          [](const shared_model::interface::RemoveSignatory &c)
+              -> ReturnType { return c.accountId(); },
+          [](const auto &) -> ReturnType { return boost::none; });
+    }
+
+    void WsvCache::invalidate(const shared_model::interface::Command &command) {
+      if (auto account_id = changedAccount(command)) {
+        accounts_.erase(*account_id);
+        signatories_.erase(*account_id);
+        account_roles_.erase(*account_id);
+        return;
+      }
+      visit_in_place(
+          command.get(),
+          [this](const shared_model::interface::AppendRole &c) {
+            account_roles_.erase(c.accountId());
+          },
+          [this](const shared_model::interface::DetachRole &c) {
+            account_roles_.erase(c.accountId());
+          },
+          [this](const shared_model::interface::CreateRole &c) {
+            role_permissions_.erase(c.roleName());
+          },
+          [](const auto &) {});
+    }
+
+    void WsvCache::invalidate(const shared_model::interface::Block &block) {
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      ++version_;
+      for (const auto &tx : block.transactions()) {
+        for (const auto &command : tx.commands()) {
+          invalidate(command);
+        }
+      }
+    }
+
+    void WsvCache::clear() {
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      ++version_;
+      accounts_.clear();
+      signatories_.clear();
+      account_roles_.clear();
+      role_permissions_.clear();
+    }
+
+    uint64_t WsvCache::hits() const {
+      return hits_;
+    }
+
+    uint64_t WsvCache::misses() const {
+      return misses_;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "cryptography/public_key.hpp"
+#include "interfaces/common_objects/account.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Command;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Cache of the committed world state which is read on every transaction
+     * and query: accounts, signatories, account roles and role permissions.
+     *
+     * Values are loaded on miss with the provided loader. Each commit bumps
+     * the version of the cache and drops entries changed by the block, a
+     * value loaded while a commit was in progress is not stored.
+     */
+    class WsvCache {
+     public:
+      static constexpr size_t kDefaultMaxEntries = 100000;
+
+      /**
+       * @param max_entries - number of entries in a single table after which
+       * the table is cleared
+       */
+      explicit WsvCache(size_t max_entries = kDefaultMaxEntries);
+
+      template <typename Loader>
+      boost::optional<std::shared_ptr<shared_model::interface::Account>>
+      getAccount(const shared_model::interface::types::AccountIdType &id,
+                 Loader &&loader) {
+        return load(accounts_, id, std::forward<Loader>(loader));
+      }
+
+      template <typename Loader>
+      boost::optional<std::vector<shared_model::interface::types::PubkeyType>>
+      getSignatories(const shared_model::interface::types::AccountIdType &id,
+                     Loader &&loader) {
+        return load(signatories_, id, std::forward<Loader>(loader));
+      }
+
+      template <typename Loader>
+      boost::optional<std::vector<shared_model::interface::types::RoleIdType>>
+      getAccountRoles(const shared_model::interface::types::AccountIdType &id,
+                      Loader &&loader) {
+        return load(account_roles_, id, std::forward<Loader>(loader));
+      }
+
+      template <typename Loader>
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getRolePermissions(const shared_model::interface::types::RoleIdType &id,
+                         Loader &&loader) {
+        return load(role_permissions_, id, std::forward<Loader>(loader));
+      }
+
+      /**
+       * Get account whose data, quorum or signatories are changed by command
+       * @param command - command to check
+       * @return id of the changed account, none if there is no such account
+       */
+      static boost::optional<shared_model::interface::types::AccountIdType>
+      changedAccount(const shared_model::interface::Command &command);
+
+      /**
+       * Drop entries which are changed by commands of the committed block
+       * @param block - committed block
+       */
+      void invalidate(const shared_model::interface::Block &block);
+
+      /**
+       * Drop all entries
+       */
+      void clear();
+
+      /**
+       * @return number of lookups served from the cache
+       */
+      uint64_t hits() const;
+
+      /**
+       * @return number of lookups which required loading
+       */
+      uint64_t misses() const;
+
+     private:
+      /**
+       * Drop entries changed by the command, must be called under exclusive
+       * lock
+       */
+      void invalidate(const shared_model::interface::Command &command);
+
+      template <typename Value>
+      using Table = std::unordered_map<std::string, Value>;
+
+      template <typename Value, typename Loader>
+      boost::optional<Value> load(Table<Value> &table,
+                                  const std::string &key,
+                                  Loader &&loader) {
+        uint64_t version;
+        {
+          std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+          auto it = table.find(key);
+          if (it != table.end()) {
+            ++hits_;
+            return it->second;
+          }
+          version = version_;
+        }
+        ++misses_;
+
+        boost::optional<Value> value = loader();
+        if (value) {
+          std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+          if (version == version_) {
+            if (table.size() >= max_entries_) {
+              table.clear();
+            }
+            table.emplace(key, *value);
+          }
+        }
+        return value;
+      }
+
+      const size_t max_entries_;
+
+      Table<std::shared_ptr<shared_model::interface::Account>> accounts_;
+      Table<std::vector<shared_model::interface::types::PubkeyType>>
+          signatories_;
+      Table<std::vector<shared_model::interface::types::RoleIdType>>
+          account_roles_;
+      Table<shared_model::interface::RolePermissionSet> role_permissions_;
+
+      /// number of commits seen by the cache
+      uint64_t version_;
+
+      std::atomic<uint64_t> hits_;
+      std::atomic<uint64_t> misses_;
+
+      mutable std::shared_timed_mutex mutex_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
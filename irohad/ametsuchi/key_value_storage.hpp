@@ -7,6 +7,8 @@
 #define IROHA_KV_STORAGE_HPP
 
 #include <boost/optional.hpp>
+#include <ciso646>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +27,37 @@ namespace iroha {
       using Identifier = uint32_t;
       using Bytes = std::vector<uint8_t>;
 
+      /**
+       * Read-only view of a stored blob, keeps the underlying memory alive
+       */
+      class BytesView {
+       public:
+        virtual const uint8_t *data() const = 0;
+
+        virtual size_t size() const = 0;
+
+        virtual ~BytesView() = default;
+      };
+
+      /**
+       * View over a blob owned by the view itself
+       */
+      class OwnedBytesView : public BytesView {
+       public:
+        explicit OwnedBytesView(Bytes bytes) : bytes_(std::move(bytes)) {}
+
+        const uint8_t *data() const override {
+          return bytes_.data();
+        }
+
+        size_t size() const override {
+          return bytes_.size();
+        }
+
+       private:
+        Bytes bytes_;
+      };
+
       /**
        * Add entity with binary data
        * @param id - reference key
@@ -39,6 +72,22 @@ namespace iroha {
        */
       virtual boost::optional<Bytes> get(Identifier id) const = 0;
 
+      /**
+       * Get read-only view of data associated with key. Implementations may
+       * back the view by a memory-mapped file to avoid copying the data
+       * @param id - reference key
+       * @return - view of the blob, if exists
+       */
+      virtual boost::optional<std::unique_ptr<BytesView>> getView(
+          Identifier id) const {
+        auto blob = get(id);
+        if (not blob) {
+          return boost::none;
+        }
+        return boost::make_optional<std::unique_ptr<BytesView>>(
+            std::make_unique<OwnedBytesView>(std::move(*blob)));
+      }
+
       /**
        * @return folder of storage
        */
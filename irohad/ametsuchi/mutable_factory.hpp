@@ -40,6 +40,8 @@ namespace iroha {
 
       /**
        * Try to apply prepared block to Ametsuchi.
+       * Prepared state is applied only if it was produced by the same
+       * transactions as the ones in the block.
        * @return true if commit is succesful, false if prepared block failed
        * to apply. WSV is not changed if it returns false.
        *
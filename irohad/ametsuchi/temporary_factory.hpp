@@ -29,6 +29,8 @@ namespace iroha {
       /**
        * Prepare state which was accumulated in temporary WSV.
        * After preparation, this state is not visible until commited.
+       * If database does not support prepared transactions, the state is kept
+       * in the open transaction of temporary wsv.
        *
        * @param wsv - state which will be prepared.
        */
@@ -7,6 +7,7 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <vector>
 
 #include "common/result.hpp"
 #include "validation/stateful_validator_common.hpp"
@@ -47,6 +48,17 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Applies transactions which were validated against the same state,
+       * their commands are executed without checks
+       * @param transactions - transactions in order of application
+       * @return error message if the transactions could not be applied, state
+       * is not changed in this case
+       */
+      virtual expected::Result<void, std::string> applyValidated(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions) = 0;
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
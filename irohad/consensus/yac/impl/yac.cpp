@@ -81,12 +81,14 @@ namespace iroha {
       // ------|Network notifications|------
 
       void Yac::onState(std::vector<VoteMessage> state) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(state)) {
-          applyState(state);
-        } else {
+        // only the storage update requires the lock, so messages are
+        // verified concurrently
+        if (not crypto_->verify(state)) {
           log_->warn(cryptoError(state));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        applyState(state);
       }
 
       // ------|Private interface|------
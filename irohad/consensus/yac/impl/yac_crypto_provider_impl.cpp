@@ -9,27 +9,88 @@
 #include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
+namespace {
+  /**
+   * Key of a verified vote: signatory, signature and the signed payload,
+   * which contains round and hashes of the vote
+   */
+  std::string verifiedVoteKey(const iroha::consensus::yac::VoteMessage &vote,
+                              const std::string &payload) {
+    auto public_key =
+        shared_model::crypto::toBinaryString(vote.signature->publicKey());
+    auto signed_data =
+        shared_model::crypto::toBinaryString(vote.signature->signedData());
+    return std::to_string(public_key.size()) + ':' + public_key
+        + std::to_string(signed_data.size()) + ':' + signed_data + payload;
+  }
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
+      constexpr size_t CryptoProviderImpl::kDefaultVerifiedVotesLimit;
+
       CryptoProviderImpl::CryptoProviderImpl(
           const shared_model::crypto::Keypair &keypair,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-              factory)
-          : keypair_(keypair), factory_(std::move(factory)) {}
+              factory,
+          std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+              verifier_pool,
+          size_t verified_votes_limit)
+          : keypair_(keypair),
+            factory_(std::move(factory)),
+            verifier_pool_(std::move(verifier_pool)),
+            verified_votes_limit_(verified_votes_limit) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
+        std::vector<std::string> payloads;
+        std::vector<std::string> keys;
+        payloads.reserve(msg.size());
+        keys.reserve(msg.size());
+        for (const auto &vote : msg) {
+          payloads.push_back(
+              PbConverters::serializeVote(vote).hash().SerializeAsString());
+          keys.push_back(verifiedVoteKey(vote, payloads.back()));
+        }
+
+        std::vector<size_t> unverified;
+        {
+          std::lock_guard<std::mutex> lock(verified_mutex_);
+          for (size_t i = 0; i < msg.size(); ++i) {
+            if (verified_votes_.count(keys[i]) == 0) {
+              unverified.push_back(i);
+            }
+          }
+        }
+        if (unverified.empty()) {
+          return true;
+        }
 
-              return shared_model::crypto::CryptoVerifier<>::verify(
-                  vote.signature->signedData(),
-                  blob,
-                  vote.signature->publicKey());
-            });
+        // entries refer to the blobs, so they are not reallocated
+        std::vector<shared_model::crypto::Blob> blobs;
+        blobs.reserve(unverified.size());
+        std::vector<shared_model::crypto::VerificationEntry> entries;
+        entries.reserve(unverified.size());
+        for (auto i : unverified) {
+          blobs.emplace_back(payloads[i]);
+          entries.push_back({msg[i].signature->signedData(),
+                             blobs.back(),
+                             msg[i].signature->publicKey()});
+        }
+        auto invalid = verifier_pool_
+            ? verifier_pool_->verify(entries)
+            : shared_model::crypto::CryptoVerifier<>::verifyBatch(entries);
+        if (not invalid.empty()) {
+          return false;
+        }
+
+        std::vector<std::string> verified;
+        verified.reserve(unverified.size());
+        for (auto i : unverified) {
+          verified.push_back(std::move(keys[i]));
+        }
+        rememberVerified(std::move(verified));
+        return true;
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
@@ -59,6 +120,20 @@ namespace iroha {
         return vote;
       }
 
+      void CryptoProviderImpl::rememberVerified(
+          std::vector<std::string> keys) {
+        std::lock_guard<std::mutex> lock(verified_mutex_);
+        for (auto &key : keys) {
+          if (verified_votes_.insert(key).second) {
+            verified_order_.push_back(std::move(key));
+          }
+        }
+        while (verified_order_.size() > verified_votes_limit_) {
+          verified_votes_.erase(verified_order_.front());
+          verified_order_.pop_front();
+        }
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
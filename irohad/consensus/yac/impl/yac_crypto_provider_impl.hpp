@@ -8,26 +8,62 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Votes are verified without any lock held, so votes of different
+       * messages can be verified simultaneously. Verified votes are
+       * remembered, the same votes propagated by other peers are not
+       * verified again
+       */
       class CryptoProviderImpl : public YacCryptoProvider {
        public:
+        static constexpr size_t kDefaultVerifiedVotesLimit = 4096;
+
+        /**
+         * @param verifier_pool - verifies signatures of a message in
+         * parallel, the calling thread verifies them if none
+         * @param verified_votes_limit - number of the latest verified votes
+         * which are remembered
+         */
         CryptoProviderImpl(
             const shared_model::crypto::Keypair &keypair,
             std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                factory);
+                factory,
+            std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+                verifier_pool = nullptr,
+            size_t verified_votes_limit = kDefaultVerifiedVotesLimit);
 
         bool verify(const std::vector<VoteMessage> &msg) override;
 
         VoteMessage getVote(YacHash hash) override;
 
        private:
+        /**
+         * Remember verified votes, the oldest ones are forgotten when the
+         * limit is exceeded
+         * @param keys - keys of verified votes
+         */
+        void rememberVerified(std::vector<std::string> keys);
+
         shared_model::crypto::Keypair keypair_;
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
+        std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+            verifier_pool_;
+
+        size_t verified_votes_limit_;
+        std::unordered_set<std::string> verified_votes_;
+        std::deque<std::string> verified_order_;
+        std::mutex verified_mutex_;
       };
     }  // namespace yac
   }    // namespace consensus
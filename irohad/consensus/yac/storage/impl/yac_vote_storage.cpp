@@ -17,7 +17,7 @@
 
 #include "consensus/yac/storage/yac_vote_storage.hpp"
 
-#include <algorithm>
+#include <tuple>
 #include <utility>
 
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
@@ -29,11 +29,7 @@ namespace iroha {
       // --------| private api |--------
 
       auto YacVoteStorage::getProposalStorage(const Round &round) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&round](const auto &storage) {
-                              return storage.getStorageKey() == round;
-                            });
+        return proposal_storages_.find(round);
       }
 
       auto YacVoteStorage::findProposalStorage(const VoteMessage &msg,
@@ -42,34 +38,83 @@ namespace iroha {
         if (val != proposal_storages_.end()) {
           return val;
         }
-        return proposal_storages_.emplace(
-            proposal_storages_.end(),
-            msg.hash.vote_round,
-            peers_in_round,
-            std::make_shared<SupermajorityCheckerImpl>());
+        return proposal_storages_
+            .emplace(std::piecewise_construct,
+                     std::forward_as_tuple(msg.hash.vote_round),
+                     std::forward_as_tuple(
+                         msg.hash.vote_round,
+                         peers_in_round,
+                         std::make_shared<SupermajorityCheckerImpl>()))
+            .first;
+      }
+
+      bool YacVoteStorage::isOutdated(const Round &round) const {
+        return round.block_round + rounds_depth_ < last_committed_block_round_;
+      }
+
+      void YacVoteStorage::removeOutdatedRounds() {
+        auto remove = [this](auto &rounds) {
+          for (auto it = rounds.begin(); it != rounds.end();) {
+            if (this->isOutdated(it->first)) {
+              it = rounds.erase(it);
+            } else {
+              ++it;
+            }
+          }
+        };
+        remove(proposal_storages_);
+        remove(processing_state_);
       }
 
       // --------| public api |--------
 
+      constexpr BlockRoundType YacVoteStorage::kDefaultRoundsDepth;
+
+      YacVoteStorage::YacVoteStorage(BlockRoundType rounds_depth)
+          : rounds_depth_(rounds_depth) {}
+
       boost::optional<Answer> YacVoteStorage::store(
           std::vector<VoteMessage> state, PeersNumberType peers_in_round) {
+        auto round = state.at(0).hash.vote_round;
+        if (isOutdated(round)) {
+          return boost::none;
+        }
+
         auto storage = findProposalStorage(state.at(0), peers_in_round);
-        return storage->insert(state);
+        auto answer = storage->second.insert(std::move(state));
+
+        // rounds are removed once per block, when the commit is collected
+        if (answer and boost::get<CommitMessage>(&*answer)
+            and round.block_round > last_committed_block_round_) {
+          last_committed_block_round_ = round.block_round;
+          removeOutdatedRounds();
+        }
+        return answer;
       }
 
       bool YacVoteStorage::isCommitted(const Round &round) {
+        if (isOutdated(round)) {
+          return true;
+        }
         auto iter = getProposalStorage(round);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return bool(iter->getState());
+        return bool(iter->second.getState());
       }
 
       ProposalState YacVoteStorage::getProcessingState(const Round &round) {
-        return processing_state_[round];
+        auto iter = processing_state_.find(round);
+        if (iter == processing_state_.end()) {
+          return ProposalState::kNotSentNotProcessed;
+        }
+        return iter->second;
       }
 
       void YacVoteStorage::nextProcessingState(const Round &round) {
+        if (isOutdated(round)) {
+          return;
+        }
         auto &val = processing_state_[round];
         switch (val) {
           case ProposalState::kNotSentNotProcessed:
@@ -26,12 +26,12 @@
 #include "consensus/yac/messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/storage_result.hpp"  // for Answer
 #include "consensus/yac/storage/yac_common.hpp"      // for ProposalHash
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/yac_types.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
-      class YacProposalStorage;
 
       /**
        * Proposal outcome states for multicast propagation strategy
@@ -67,6 +67,8 @@ namespace iroha {
 
       /**
        * Class provide storage for votes and useful methods for it.
+       * Rounds are indexed by hash and kept in a window behind the last
+       * committed block round, older rounds are removed
        */
       class YacVoteStorage {
        private:
@@ -75,7 +77,7 @@ namespace iroha {
         /**
          * Retrieve iterator for storage with specified key
          * @param round - key of that storage
-         * @return iterator to proposal storage
+         * @return iterator to the pair of round and its proposal storage
          */
         auto getProposalStorage(const Round &round);
 
@@ -90,15 +92,34 @@ namespace iroha {
         auto findProposalStorage(const VoteMessage &msg,
                                  PeersNumberType peers_in_round);
 
+        /**
+         * Check whether the round is behind the window of kept rounds
+         */
+        bool isOutdated(const Round &round) const;
+
+        /**
+         * Remove proposal storages and processing states of outdated rounds
+         */
+        void removeOutdatedRounds();
+
        public:
         // --------| public api |--------
 
+        static constexpr BlockRoundType kDefaultRoundsDepth = 2;
+
+        /**
+         * @param rounds_depth - number of block rounds before the last
+         * committed one, which are kept in the storage
+         */
+        explicit YacVoteStorage(
+            BlockRoundType rounds_depth = kDefaultRoundsDepth);
+
         /**
          * Insert votes in storage
          * @param state - current message with votes
          * @param peers_in_round - number of peers participated in round
          * @return structure with result of inserting.
-         * boost::none if msg not valid.
+         * boost::none if msg not valid or its round is outdated.
          */
         boost::optional<Answer> store(std::vector<VoteMessage> state,
                                       PeersNumberType peers_in_round);
@@ -106,7 +127,7 @@ namespace iroha {
         /**
          * Provide status about closing round of proposal/block
          * @param round, in which proposal/block is supposed to be committed
-         * @return true, if round closed
+         * @return true, if round closed or outdated
          */
         bool isCommitted(const Round &round);
 
@@ -134,7 +155,8 @@ namespace iroha {
         /**
          * Active proposal storages
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        std::unordered_map<Round, YacProposalStorage, RoundTypeHasher>
+            proposal_storages_;
 
         /**
          * Processing set provide user flags about processing some
@@ -143,6 +165,16 @@ namespace iroha {
          */
         std::unordered_map<Round, ProposalState, RoundTypeHasher>
             processing_state_;
+
+        /**
+         * Number of block rounds kept before the last committed one
+         */
+        BlockRoundType rounds_depth_;
+
+        /**
+         * Block round of the last commit collected by the storage
+         */
+        BlockRoundType last_committed_block_round_ = 0;
       };
 
     }  // namespace yac
@@ -6,14 +6,15 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
 #include <memory>
 
+#include "common/bind.hpp"
 #include "consensus/yac/messages.hpp"
 #include "consensus/yac/storage/yac_common.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 #include "yac.pb.h"
 
 namespace iroha {
@@ -23,8 +24,12 @@ namespace iroha {
 
       NetworkImpl::NetworkImpl(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
-              async_call)
-          : async_call_(async_call) {}
+              async_call,
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::shared_ptr<network::ChannelPool> channel_pool)
+          : async_call_(async_call),
+            peer_query_factory_(std::move(peer_query_factory)),
+            channel_pool_(std::move(channel_pool)) {}
 
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
@@ -33,20 +38,23 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
-        createPeerConnection(to);
+        std::shared_ptr<proto::Yac::StubInterface> stub =
+            channel_pool_->createClient<proto::Yac>(to.address());
 
-        proto::State request;
-        for (const auto &vote : state) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
+        if (state.size() > 1 and peer_query_factory_) {
+          bool legacy = [&] {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return legacy_peers_.count(to.address()) != 0;
+          }();
+          if (not legacy) {
+            if (auto certificate = commitCertificate(state)) {
+              sendCertificate(stub, to.address(), *certificate, state);
+              return;
+            }
+          }
         }
 
-        async_call_->Call([&](auto context, auto cq) {
-          return peers_.at(to.address())->AsyncSendState(context, request, cq);
-        });
-
-        async_call_->log_->info(
-            "Send votes bundle[size={}] to {}", state.size(), to.address());
+        sendVotes(stub, to.address(), state);
       }
 
       grpc::Status NetworkImpl::SendState(
@@ -72,12 +80,134 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(
-          const shared_model::interface::Peer &peer) {
-        if (peers_.count(peer.address()) == 0) {
-          peers_[peer.address()] =
-              network::createClient<proto::Yac>(peer.address());
+      grpc::Status NetworkImpl::SendCommitCertificate(
+          ::grpc::ServerContext *context,
+          const ::iroha::consensus::yac::proto::CommitCertificate *request,
+          ::google::protobuf::Empty *response) {
+        if (not peer_query_factory_) {
+          return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                              "Commit certificates are not supported");
+        }
+
+        auto state = signerKeys() | [&](const auto &keys) {
+          return PbConverters::deserializeCertificate(*request, keys);
+        };
+        if (not state or not sameKeys(*state)) {
+          async_call_->log_->info(
+              "Commit certificate from {} does not match ledger peers",
+              context->peer());
+          return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                              "Certificate does not match ledger peers");
+        }
+
+        async_call_->log_->info("Receive commit certificate[size={}] from {}",
+                                state->size(),
+                                context->peer());
+
+        handler_.lock()->onState(std::move(*state));
+        return grpc::Status::OK;
+      }
+
+      void NetworkImpl::sendVotes(
+          std::shared_ptr<proto::Yac::StubInterface> stub,
+          const shared_model::interface::types::AddressType &to,
+          const std::vector<VoteMessage> &state) {
+        proto::State request;
+        for (const auto &vote : state) {
+          auto pb_vote = request.add_votes();
+          *pb_vote = PbConverters::serializeVote(vote);
+        }
+
+        async_call_->Call(
+            [&](auto context, auto cq) {
+              return stub->AsyncSendState(context, request, cq);
+            },
+            channel_pool_->track<google::protobuf::Empty>(to));
+
+        async_call_->log_->info(
+            "Send votes bundle[size={}] to {}", state.size(), to);
+      }
+
+      void NetworkImpl::sendCertificate(
+          std::shared_ptr<proto::Yac::StubInterface> stub,
+          const shared_model::interface::types::AddressType &to,
+          const proto::CommitCertificate &certificate,
+          const std::vector<VoteMessage> &state) {
+        auto on_response = [this, stub, to, state](
+                               const grpc::Status &status,
+                               const google::protobuf::Empty &) {
+          switch (status.error_code()) {
+            case grpc::StatusCode::OK:
+              return;
+            case grpc::StatusCode::UNIMPLEMENTED: {
+              std::lock_guard<std::mutex> lock(mutex_);
+              legacy_peers_.insert(to);
+            } break;
+            case grpc::StatusCode::FAILED_PRECONDITION:
+              break;
+            default:
+              async_call_->log_->warn(
+                  "RPC to {} failed: {}", to, status.error_message());
+              return;
+          }
+          async_call_->log_->info(
+              "Peer {} did not accept commit certificate: {}",
+              to,
+              status.error_message());
+          this->sendVotes(stub, to, state);
+        };
+
+        async_call_->Call(
+            [&](auto context, auto cq) {
+              return stub->AsyncSendCommitCertificate(context, certificate, cq);
+            },
+            channel_pool_->track<google::protobuf::Empty>(
+                to, std::move(on_response)));
+
+        async_call_->log_->info("Send commit certificate[size={}] to {}",
+                                certificate.signatures_size(),
+                                to);
+      }
+
+      boost::optional<proto::CommitCertificate> NetworkImpl::commitCertificate(
+          const std::vector<VoteMessage> &state) {
+        const auto &hash = state.front().hash;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          auto it = certificates_.find(hash.vote_round);
+          if (it != certificates_.end() and it->second.first == hash) {
+            return it->second.second;
+          }
         }
+
+        auto certificate = signerKeys() | [&](const auto &keys) {
+          return PbConverters::serializeCertificate(state, keys);
+        };
+        if (certificate) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          certificates_[hash.vote_round] = std::make_pair(hash, *certificate);
+          if (certificates_.size() > kCachedCertificates) {
+            certificates_.erase(certificates_.begin());
+          }
+        }
+        return certificate;
+      }
+
+      boost::optional<std::vector<shared_model::crypto::PublicKey>>
+      NetworkImpl::signerKeys() const {
+        auto peers = peer_query_factory_->createPeerQuery() |
+            [](const auto &query) { return query->getLedgerPeers(); };
+        return peers | [](const auto &peers) {
+          std::vector<shared_model::crypto::PublicKey> keys;
+          keys.reserve(peers.size());
+          for (const auto &peer : peers) {
+            keys.push_back(peer->pubkey());
+          }
+          std::sort(keys.begin(), keys.end(), [](const auto &a, const auto &b) {
+            return a.blob() < b.blob();
+          });
+          return boost::make_optional(std::move(keys));
+        };
       }
 
     }  // namespace yac
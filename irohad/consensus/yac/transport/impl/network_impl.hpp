@@ -9,13 +9,17 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "yac.grpc.pb.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <unordered_set>
 
+#include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/yac/messages.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -27,13 +31,28 @@ namespace iroha {
 
       /**
        * Class which provides implementation of transport for consensus based on
-       * grpc
+       * grpc.
+       * Votes of a commit are sent as commit certificate when ledger peers
+       * are known, the certificate of a round is cached, so it is built once
+       * for all peers, including lagging ones. Peers which do not support
+       * certificates receive the votes with SendState
        */
       class NetworkImpl : public YacNetwork, public proto::Yac::Service {
        public:
+        /**
+         * @param async_call - client of asynchronous calls
+         * @param peer_query_factory - source of ledger peers, which signers
+         * of certificates are referred to; certificates are not used if it is
+         * not provided
+         * @param channel_pool - channels to peers
+         */
         explicit NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
-                async_call);
+                async_call,
+            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory =
+                nullptr,
+            std::shared_ptr<network::ChannelPool> channel_pool =
+                std::make_shared<network::ChannelPool>());
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
 
@@ -50,20 +69,49 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::State *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive votes of a commit from another peer, the votes are
+         * restored with ledger peers and passed as state
+         */
+        grpc::Status SendCommitCertificate(
+            ::grpc::ServerContext *context,
+            const ::iroha::consensus::yac::proto::CommitCertificate *request,
+            ::google::protobuf::Empty *response) override;
+
        private:
+        /// number of rounds which commit certificates are cached for
+        static constexpr size_t kCachedCertificates = 4;
+
+        /**
+         * Send votes as state
+         */
+        void sendVotes(std::shared_ptr<proto::Yac::StubInterface> stub,
+                       const shared_model::interface::types::AddressType &to,
+                       const std::vector<VoteMessage> &state);
+
         /**
-         * Create GRPC connection for given peer if it does not exist in
-         * peers map
-         * @param peer to instantiate connection with
+         * Send commit certificate, votes are sent as state if the peer
+         * does not support or cannot apply the certificate
          */
-        void createPeerConnection(const shared_model::interface::Peer &peer);
+        void sendCertificate(
+            std::shared_ptr<proto::Yac::StubInterface> stub,
+            const shared_model::interface::types::AddressType &to,
+            const proto::CommitCertificate &certificate,
+            const std::vector<VoteMessage> &state);
 
         /**
-         * Mapping of peer objects to connections
+         * Get certificate of votes from the cache, or build it
+         * @return certificate, or none if votes do not form it
          */
-        std::unordered_map<shared_model::interface::types::AddressType,
-                           std::unique_ptr<proto::Yac::StubInterface>>
-            peers_;
+        boost::optional<proto::CommitCertificate> commitCertificate(
+            const std::vector<VoteMessage> &state);
+
+        /**
+         * @return public keys of ledger peers in ascending order, which
+         * signers of certificates are referred to
+         */
+        boost::optional<std::vector<shared_model::crypto::PublicKey>>
+        signerKeys() const;
 
         /**
          * Subscriber of network messages
@@ -75,6 +123,28 @@ namespace iroha {
          */
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
+
+        std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+
+        std::shared_ptr<network::ChannelPool> channel_pool_;
+
+        /**
+         * Recent commit certificates with the hashes they are built for
+         */
+        std::map<Round, std::pair<YacHash, proto::CommitCertificate>>
+            certificates_;
+
+        /**
+         * Addresses of peers which do not support commit certificates
+         */
+        std::unordered_set<shared_model::interface::types::AddressType>
+            legacy_peers_;
+
+        /**
+         * Guards the cache and the legacy peers, which are accessed by voting
+         * and by completion of calls
+         */
+        std::mutex mutex_;
       };
 
     }  // namespace yac
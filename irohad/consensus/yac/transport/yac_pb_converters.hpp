@@ -6,6 +6,8 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <algorithm>
+
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/byteutils.hpp"
 #include "consensus/yac/messages.hpp"
@@ -49,6 +51,34 @@ namespace iroha {
           return vote;
         }
 
+        /**
+         * Create signature object from binary key and signature
+         * @param msg - format of the error logged if the signature is invalid
+         * @return the signature, nullptr if it is invalid
+         */
+        static std::shared_ptr<shared_model::interface::Signature>
+        deserializeSignature(const std::string &pubkey,
+                             const std::string &signature,
+                             const std::string &msg) {
+          static shared_model::proto::ProtoCommonObjectsFactory<
+              shared_model::validation::FieldValidator>
+              factory_;
+
+          std::shared_ptr<shared_model::interface::Signature> result;
+          factory_
+              .createSignature(shared_model::crypto::PublicKey(pubkey),
+                               shared_model::crypto::Signed(signature))
+              .match(
+                  [&](iroha::expected::Value<
+                      std::unique_ptr<shared_model::interface::Signature>>
+                          &sig) { result = std::move(sig.value); },
+                  [&](iroha::expected::Error<std::string> &reason) {
+                    logger::log("YacPbConverter::deserializeSignature")
+                        ->error(msg, reason.error);
+                  });
+          return result;
+        }
+
        public:
         static proto::Vote serializeVotePayload(const VoteMessage &vote) {
           auto pb_vote = serializeRoundAndHashes(vote);
@@ -89,41 +119,140 @@ namespace iroha {
 
         static boost::optional<VoteMessage> deserializeVote(
             const proto::Vote &pb_vote) {
-          static shared_model::proto::ProtoCommonObjectsFactory<
-              shared_model::validation::FieldValidator>
-              factory_;
-
           auto vote = deserealizeRoundAndHashes(pb_vote);
 
-          auto deserialize =
-              [&](auto &pubkey, auto &signature, auto &val, const auto &msg) {
-                factory_
-                    .createSignature(shared_model::crypto::PublicKey(pubkey),
-                                     shared_model::crypto::Signed(signature))
-                    .match(
-                        [&](iroha::expected::Value<
-                            std::unique_ptr<shared_model::interface::Signature>>
-                                &sig) { val = std::move(sig.value); },
-                        [&](iroha::expected::Error<std::string> &reason) {
-                          logger::log("YacPbConverter::deserializeVote")
-                              ->error(msg, reason.error);
-                        });
-              };
-
           if (pb_vote.hash().has_block_signature()) {
-            deserialize(pb_vote.hash().block_signature().pubkey(),
-                        pb_vote.hash().block_signature().signature(),
-                        vote.hash.block_signature,
-                        "Cannot build vote hash block signature: {}");
+            vote.hash.block_signature = deserializeSignature(
+                pb_vote.hash().block_signature().pubkey(),
+                pb_vote.hash().block_signature().signature(),
+                "Cannot build vote hash block signature: {}");
           }
 
-          deserialize(pb_vote.signature().pubkey(),
-                      pb_vote.signature().signature(),
-                      vote.signature,
-                      "Cannot build vote signature: {}");
+          vote.signature =
+              deserializeSignature(pb_vote.signature().pubkey(),
+                                   pb_vote.signature().signature(),
+                                   "Cannot build vote signature: {}");
 
           return vote;
         }
+
+        /**
+         * Serialize votes for the same hash as commit certificate
+         * @param votes - votes of the commit
+         * @param keys - public keys of peers, which the bitmap of signers
+         * refers to
+         * @return certificate, or none if votes are for different hashes,
+         * signed by peers out of the keys, or contain block signatures of
+         * other peers
+         */
+        static boost::optional<proto::CommitCertificate> serializeCertificate(
+            const std::vector<VoteMessage> &votes,
+            const std::vector<shared_model::crypto::PublicKey> &keys) {
+          if (votes.empty()) {
+            return boost::none;
+          }
+          const auto &hash = votes.front().hash;
+          bool with_block_signatures = hash.block_signature != nullptr;
+
+          std::vector<const VoteMessage *> signers(keys.size(), nullptr);
+          for (const auto &vote : votes) {
+            const auto &key = vote.signature->publicKey();
+            auto it = std::find(keys.begin(), keys.end(), key);
+            if (it == keys.end() or signers[it - keys.begin()] != nullptr
+                or vote.hash != hash
+                or (vote.hash.block_signature != nullptr)
+                    != with_block_signatures
+                or (with_block_signatures
+                    and vote.hash.block_signature->publicKey() != key)) {
+              return boost::none;
+            }
+            signers[it - keys.begin()] = &vote;
+          }
+
+          proto::CommitCertificate pb_certificate;
+          *pb_certificate.mutable_hash() =
+              serializeRoundAndHashes(votes.front()).hash();
+          std::string bitmap((keys.size() + 7) / 8, 0);
+          for (size_t i = 0; i < signers.size(); ++i) {
+            if (signers[i] == nullptr) {
+              continue;
+            }
+            bitmap[i / 8] |= 1 << (i % 8);
+            pb_certificate.add_signatures(shared_model::crypto::toBinaryString(
+                signers[i]->signature->signedData()));
+            if (with_block_signatures) {
+              pb_certificate.add_block_signatures(
+                  shared_model::crypto::toBinaryString(
+                      signers[i]->hash.block_signature->signedData()));
+            }
+          }
+          pb_certificate.set_signers(bitmap);
+
+          return pb_certificate;
+        }
+
+        /**
+         * Restore votes of commit certificate
+         * @param pb_certificate - certificate to restore
+         * @param keys - public keys of peers, which the bitmap of signers
+         * refers to
+         * @return votes of the certificate, or none if it does not match
+         * the keys or contains invalid signatures
+         */
+        static boost::optional<std::vector<VoteMessage>>
+        deserializeCertificate(
+            const proto::CommitCertificate &pb_certificate,
+            const std::vector<shared_model::crypto::PublicKey> &keys) {
+          const auto &bitmap = pb_certificate.signers();
+          const auto &signatures = pb_certificate.signatures();
+          const auto &block_signatures = pb_certificate.block_signatures();
+          if (bitmap.size() != (keys.size() + 7) / 8
+              or (not block_signatures.empty()
+                  and block_signatures.size() != signatures.size())) {
+            return boost::none;
+          }
+
+          proto::Vote pb_vote;
+          *pb_vote.mutable_hash() = pb_certificate.hash();
+          auto hash = deserealizeRoundAndHashes(pb_vote).hash;
+
+          std::vector<VoteMessage> votes;
+          for (size_t i = 0; i < bitmap.size() * 8; ++i) {
+            if (not(bitmap[i / 8] & (1 << (i % 8)))) {
+              continue;
+            }
+            auto index = static_cast<int>(votes.size());
+            if (i >= keys.size() or index == signatures.size()) {
+              return boost::none;
+            }
+            auto pubkey = shared_model::crypto::toBinaryString(keys[i]);
+
+            VoteMessage vote;
+            vote.hash = hash;
+            vote.signature =
+                deserializeSignature(pubkey,
+                                     signatures.Get(index),
+                                     "Cannot build certificate signature: {}");
+            if (not block_signatures.empty()) {
+              vote.hash.block_signature = deserializeSignature(
+                  pubkey,
+                  block_signatures.Get(index),
+                  "Cannot build certificate block signature: {}");
+              if (not vote.hash.block_signature) {
+                return boost::none;
+              }
+            }
+            if (not vote.signature) {
+              return boost::none;
+            }
+            votes.push_back(std::move(vote));
+          }
+          if (votes.size() != static_cast<size_t>(signatures.size())) {
+            return boost::none;
+          }
+
+          return votes;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
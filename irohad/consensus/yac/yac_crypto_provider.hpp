@@ -17,7 +17,7 @@ namespace iroha {
       class YacCryptoProvider {
        public:
         /**
-         * Verify signatory of message
+         * Verify signatory of message, may be called from several threads
          * @param msg - for verification
          * @return true if signature correct
          */
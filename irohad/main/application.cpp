@@ -27,10 +27,12 @@
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/default_validator.hpp"
 #include "validators/field_validator.hpp"
+#include "validators/pooled_signatures_validator.hpp"
 #include "validators/protobuf/proto_block_validator.hpp"
 #include "validators/protobuf/proto_proposal_validator.hpp"
 #include "validators/protobuf/proto_query_validator.hpp"
@@ -47,6 +49,10 @@ using namespace iroha::consensus::yac;
 
 using namespace std::chrono_literals;
 
+/// connections of the storage pool left to the proposal state, queries and
+/// commits while the stateful validator workers hold theirs
+static constexpr size_t kReservedConnections = 4;
+
 /**
  * Configuring iroha daemon
  */
@@ -71,6 +77,11 @@ Irohad::Irohad(const std::string &block_store_dir,
       vote_delay_(vote_delay),
       is_mst_supported_(opt_mst_gossip_params),
       opt_mst_gossip_params_(opt_mst_gossip_params),
+      validation_concurrency_(1),
+      torii_validation_threads_(0),
+      packing_policy_(std::make_shared<ordering::FifoPackingPolicy>()),
+      max_carried_over_batches_(
+          ordering::OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverBatches),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -116,6 +127,21 @@ void Irohad::dropStorage() {
   storage->reset();
 }
 
+void Irohad::setValidationConcurrency(size_t concurrency) {
+  validation_concurrency_ = concurrency;
+}
+
+void Irohad::setToriiValidationThreads(size_t threads) {
+  torii_validation_threads_ = threads;
+}
+
+void Irohad::setProposalPacking(
+    std::shared_ptr<ordering::ProposalPackingPolicy> packing_policy,
+    size_t max_carried_over_batches) {
+  packing_policy_ = std::move(packing_policy);
+  max_carried_over_batches_ = max_carried_over_batches;
+}
+
 /**
  * Initializing iroha daemon storage
  */
@@ -173,10 +199,27 @@ void Irohad::initBatchParser() {
 void Irohad::initValidators() {
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
       shared_model::validation::DefaultProposalValidator>>();
-  stateful_validator =
-      std::make_shared<StatefulValidatorImpl>(std::move(factory), batch_parser);
+  // each worker of the stateful validator holds a connection of the storage
+  // pool for the whole validation
+  const size_t max_concurrency =
+      StorageImpl::kDefaultPoolSize - kReservedConnections;
+  if (validation_concurrency_ > max_concurrency) {
+    log_->warn("validation concurrency {} is limited to {} by the pool of {} "
+               "database connections",
+               validation_concurrency_,
+               max_concurrency,
+               StorageImpl::kDefaultPoolSize);
+    validation_concurrency_ = max_concurrency;
+  }
+  stateful_validator = std::make_shared<StatefulValidatorImpl>(
+      std::move(factory), batch_parser, storage, validation_concurrency_);
+  // the calling thread verifies a part of each batch as well
+  verifier_pool_ =
+      std::make_shared<shared_model::crypto::CryptoVerifierPool<>>(
+          std::max(std::thread::hardware_concurrency(), 1u) - 1);
   chain_validator = std::make_shared<ChainValidatorImpl>(
-      std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
+      std::make_shared<consensus::yac::SupermajorityCheckerImpl>(),
+      verifier_pool_);
 
   log_->info("[Init] => validators");
 }
@@ -187,6 +230,7 @@ void Irohad::initValidators() {
 void Irohad::initNetworkClient() {
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>();
+  channel_pool_ = std::make_shared<network::ChannelPool>();
 }
 
 void Irohad::initFactories() {
@@ -195,10 +239,14 @@ void Irohad::initFactories() {
       shared_model::validation::AbstractValidator<iroha::protocol::Transaction>>
       proto_transaction_validator = std::make_shared<
           shared_model::validation::ProtoTransactionValidator>();
+  // signatures of all transactions of a proposal are verified on the pool
   std::unique_ptr<shared_model::validation::AbstractValidator<
       shared_model::interface::Proposal>>
-      proposal_validator = std::make_unique<
-          shared_model::validation::DefaultProposalValidator>();
+      proposal_validator =
+          std::make_unique<shared_model::validation::PooledSignaturesValidator<
+              shared_model::interface::Proposal,
+              shared_model::validation::DefaultUnsignedProposalValidator>>(
+              verifier_pool_);
   std::unique_ptr<
       shared_model::validation::AbstractValidator<iroha::protocol::Proposal>>
       proto_proposal_validator =
@@ -317,9 +365,12 @@ void Irohad::initOrderingGate() {
                                                  batch_parser,
                                                  transaction_batch_factory_,
                                                  async_call_,
+                                                 channel_pool_,
                                                  std::move(factory),
                                                  proposal_factory,
                                                  persistent_cache,
+                                                 packing_policy_,
+                                                 max_carried_over_batches_,
                                                  {blocks.back()->height(), 1},
                                                  delay);
   log_->info("[Init] => init ordering gate - [{}]",
@@ -363,8 +414,8 @@ void Irohad::initConsensusCache() {
  * Initializing block loader
  */
 void Irohad::initBlockLoader() {
-  block_loader =
-      loader_init.initBlockLoader(storage, storage, consensus_result_cache_);
+  block_loader = loader_init.initBlockLoader(
+      storage, storage, consensus_result_cache_, channel_pool_);
 
   log_->info("[Init] => block loader");
 }
@@ -380,7 +431,9 @@ void Irohad::initConsensusGate() {
                                               consensus_result_cache_,
                                               vote_delay_,
                                               async_call_,
-                                              common_objects_factory_);
+                                              channel_pool_,
+                                              common_objects_factory_,
+                                              verifier_pool_);
   consensus_gate->onOutcome().subscribe(
       consensus_gate_objects.get_subscriber());
   log_->info("[Init] => consensus gate");
@@ -412,6 +465,16 @@ void Irohad::initPeerCommunicationService() {
     switch (event.sync_outcome) {
       case SynchronizationOutcomeType::kCommit:
         log_->info(R"(~~~~~~~~~| COMMIT =^._.^= |~~~~~~~~~ )");
+        // channels to peers which are not in the ledger any more are closed
+        storage->createPeerQuery() |
+            [](const auto &query) { return query->getLedgerPeers(); } |
+            [this](const auto &peers) {
+              std::vector<std::string> addresses;
+              for (const auto &peer : peers) {
+                addresses.push_back(peer->address());
+              }
+              channel_pool_->retain(addresses);
+            };
         break;
       case SynchronizationOutcomeType::kReject:
         log_->info(R"(~~~~~~~~~| REJECT \(*.*)/ |~~~~~~~~~ )");
@@ -443,7 +506,8 @@ void Irohad::initMstProcessor() {
         batch_parser,
         transaction_batch_factory_,
         persistent_cache,
-        keypair.publicKey());
+        keypair.publicKey(),
+        channel_pool_);
     mst_propagation = std::make_shared<GossipPropagationStrategy>(
         storage, rxcpp::observe_on_new_thread(), *opt_mst_gossip_params_);
   } else {
@@ -488,7 +552,11 @@ void Irohad::initTransactionCommandService() {
           consensus_gate_objects.get_observable().map([](const auto &) {
             return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
           }),
-          2);  // TODO 18.01.2019 igor-egorov, make it configurable IR-230
+          2,  // TODO 18.01.2019 igor-egorov, make it configurable IR-230
+          torii_validation_threads_ > 0
+              ? std::make_shared<::torii::StatelessValidationPool>(
+                    transaction_factory, torii_validation_threads_)
+              : nullptr);
 
   log_->info("[Init] => command service");
 }
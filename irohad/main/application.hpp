@@ -98,6 +98,34 @@ class Irohad {
    */
   virtual void dropStorage();
 
+  /**
+   * Validate independent transactions of a proposal concurrently, must be
+   * called before init()
+   * @param concurrency - number of concurrent validations, 1 to validate
+   * transactions one after another. It is limited by the number of database
+   * connections which are not reserved for other components
+   */
+  void setValidationConcurrency(size_t concurrency);
+
+  /**
+   * Validate transactions of lists received by Torii on worker threads, must
+   * be called before init()
+   * @param threads - number of threads, 0 to validate transactions on the
+   * thread handling the request
+   */
+  void setToriiValidationThreads(size_t threads);
+
+  /**
+   * Set the policy which selects batches for proposals of the ordering
+   * service, must be called before init()
+   * @param packing_policy - policy of the ordering service
+   * @param max_carried_over_batches - number of batches which did not get
+   * into a proposal and are kept for the next one
+   */
+  void setProposalPacking(
+      std::shared_ptr<iroha::ordering::ProposalPackingPolicy> packing_policy,
+      size_t max_carried_over_batches);
+
   /**
    * Run worker threads for start performing
    * @return void value on success, error message otherwise
@@ -164,6 +192,10 @@ class Irohad {
   bool is_mst_supported_;
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
+  size_t validation_concurrency_;
+  size_t torii_validation_threads_;
+  std::shared_ptr<iroha::ordering::ProposalPackingPolicy> packing_policy_;
+  size_t max_carried_over_batches_;
 
   // ------------------------| internal dependencies |-------------------------
 
@@ -173,6 +205,9 @@ class Irohad {
   // batch parser
   std::shared_ptr<shared_model::interface::TransactionBatchParser> batch_parser;
 
+  // signature verification threads
+  std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>> verifier_pool_;
+
   // validators
   std::shared_ptr<iroha::validation::StatefulValidator> stateful_validator;
   std::shared_ptr<iroha::validation::ChainValidator> chain_validator;
@@ -184,6 +219,9 @@ class Irohad {
   std::shared_ptr<iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
       async_call_;
 
+  // channels to peers shared by internal transports
+  std::shared_ptr<iroha::network::ChannelPool> channel_pool_;
+
   // common objects factory
   std::shared_ptr<shared_model::interface::CommonObjectsFactory>
       common_objects_factory_;
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Offline converter of block stores written in the legacy json format into
+ * the binary block file format. Must be run while irohad is stopped.
+ */
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+/**
+ * Gflag validator for the block store path
+ */
+bool validate_block_store_path(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+DEFINE_string(block_store_path, "", "Path to the block store to convert");
+DEFINE_validator(block_store_path, &validate_block_store_path);
+
+/**
+ * Overwrite file contents so that a crash in the middle leaves either the old
+ * or the new record
+ * @param path - file to overwrite
+ * @param record - new contents
+ * @return true if the file was replaced
+ */
+static bool replaceFile(const boost::filesystem::path &path,
+                        const iroha::ametsuchi::KeyValueStorage::Bytes &record) {
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+  {
+    boost::filesystem::ofstream file(tmp_path, std::ofstream::binary);
+    if (not file.is_open()) {
+      return false;
+    }
+    file.write(reinterpret_cast<const char *>(record.data()), record.size());
+    if (not file.good()) {
+      return false;
+    }
+  }
+  boost::system::error_code err;
+  boost::filesystem::rename(tmp_path, path, err);
+  return not err;
+}
+
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log = logger::log("BlockStoreConverter");
+
+  auto store = iroha::ametsuchi::FlatFile::create(FLAGS_block_store_path);
+  if (not store) {
+    log->error("Cannot open block store {}", FLAGS_block_store_path);
+    return EXIT_FAILURE;
+  }
+
+  iroha::ametsuchi::BlockFileFormat format(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>());
+
+  size_t converted = 0;
+  const auto last_id = (*store)->last_id();
+  for (iroha::ametsuchi::KeyValueStorage::Identifier id = 1; id <= last_id;
+       ++id) {
+    auto record = (*store)->get(id);
+    if (not record) {
+      log->error("Cannot read block {}", id);
+      return EXIT_FAILURE;
+    }
+    if (iroha::ametsuchi::BlockFileFormat::isBinary(record->data(),
+                                                    record->size())) {
+      continue;
+    }
+
+    auto result = format.deserialize(*record) | [&format](const auto &block) {
+      return format.serialize(*block);
+    };
+    auto ok = result.match(
+        [&](const iroha::expected::Value<
+            iroha::ametsuchi::KeyValueStorage::Bytes> &v) {
+          return replaceFile(boost::filesystem::path{(*store)->directory()}
+                                 / iroha::ametsuchi::FlatFile::id_to_name(id),
+                             v.value);
+        },
+        [&](const iroha::expected::Error<std::string> &e) {
+          log->error("Cannot convert block {}: {}", id, e.error);
+          return false;
+        });
+    if (not ok) {
+      log->error("Conversion stopped at block {}", id);
+      return EXIT_FAILURE;
+    }
+    ++converted;
+  }
+
+  log->info("Converted {} of {} blocks", converted, last_id);
+  gflags::ShutDownCommandLineFlags();
+  return EXIT_SUCCESS;
+}
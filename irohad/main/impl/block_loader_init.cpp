@@ -19,20 +19,23 @@ auto BlockLoaderInit::createService(
 }
 
 auto BlockLoaderInit::createLoader(
-    std::shared_ptr<PeerQueryFactory> peer_query_factory) {
+    std::shared_ptr<PeerQueryFactory> peer_query_factory,
+    std::shared_ptr<ChannelPool> channel_pool) {
   shared_model::proto::ProtoBlockFactory factory(
       std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(),
       std::make_unique<shared_model::validation::ProtoBlockValidator>());
   return std::make_shared<BlockLoaderImpl>(std::move(peer_query_factory),
-                                           std::move(factory));
+                                           std::move(factory),
+                                           std::move(channel_pool));
 }
 
 std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<BlockQueryFactory> block_query_factory,
-    std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache) {
+    std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
+    std::shared_ptr<ChannelPool> channel_pool) {
   service = createService(std::move(block_query_factory),
                           std::move(consensus_result_cache));
-  loader = createLoader(std::move(peer_query_factory));
+  loader = createLoader(std::move(peer_query_factory), std::move(channel_pool));
   return loader;
 }
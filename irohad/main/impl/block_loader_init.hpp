@@ -32,10 +32,12 @@ namespace iroha {
        * Create block loader for loading blocks from given peer factory by top
        * block
        * @param peer_query_factory - factory for peer query component creation
+       * @param channel_pool - channels to peers
        * @return initialized loader
        */
       auto createLoader(
-          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory);
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::shared_ptr<ChannelPool> channel_pool);
 
      public:
       /**
@@ -43,12 +45,14 @@ namespace iroha {
        * @param peer_query_factory - factory to peer query component
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
+       * @param channel_pool - channels to peers
        * @return initialized service
        */
       std::shared_ptr<BlockLoader> initBlockLoader(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
-          std::shared_ptr<consensus::ConsensusResultCache> block_cache);
+          std::shared_ptr<consensus::ConsensusResultCache> block_cache,
+          std::shared_ptr<ChannelPool> channel_pool);
 
       std::shared_ptr<BlockLoaderImpl> loader;
       std::shared_ptr<BlockLoaderService> service;
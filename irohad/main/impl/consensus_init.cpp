@@ -36,17 +36,26 @@ namespace iroha {
       auto YacInit::createNetwork(
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
-              async_call) {
-        consensus_network = std::make_shared<NetworkImpl>(async_call);
+              async_call,
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::shared_ptr<iroha::network::ChannelPool> channel_pool) {
+        consensus_network =
+            std::make_shared<NetworkImpl>(std::move(async_call),
+                                          std::move(peer_query_factory),
+                                          std::move(channel_pool));
         return consensus_network;
       }
 
       auto YacInit::createCryptoProvider(
           const shared_model::crypto::Keypair &keypair,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-              common_objects_factory) {
+              common_objects_factory,
+          std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+              verifier_pool) {
         auto crypto = std::make_shared<CryptoProviderImpl>(
-            keypair, std::move(common_objects_factory));
+            keypair,
+            std::move(common_objects_factory),
+            std::move(verifier_pool));
 
         return crypto;
       }
@@ -92,12 +101,20 @@ namespace iroha {
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<iroha::network::ChannelPool> channel_pool,
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-              common_objects_factory) {
+              common_objects_factory,
+          std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+              verifier_pool) {
         return Yac::create(
             YacVoteStorage(),
-            createNetwork(std::move(async_call)),
-            createCryptoProvider(keypair, std::move(common_objects_factory)),
+            createNetwork(std::move(async_call),
+                          std::move(peer_query_factory),
+                          std::move(channel_pool)),
+            createCryptoProvider(keypair,
+                                 std::move(common_objects_factory),
+                                 std::move(verifier_pool)),
             createTimer(delay_milliseconds),
             initial_order);
       }
@@ -113,15 +130,21 @@ namespace iroha {
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<iroha::network::ChannelPool> channel_pool,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-              common_objects_factory) {
+              common_objects_factory,
+          std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+              verifier_pool) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
                              vote_delay_milliseconds,
                              std::move(async_call),
-                             std::move(common_objects_factory));
+                             std::move(channel_pool),
+                             peer_query_factory,
+                             std::move(common_objects_factory),
+                             std::move(verifier_pool));
         consensus_network->subscribe(yac);
 
         auto hash_provider = createHashProvider();
@@ -31,6 +31,7 @@
 #include "consensus/yac/yac_gate.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "network/block_loader.hpp"
@@ -47,13 +48,19 @@ namespace iroha {
         auto createPeerOrderer(
             std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory);
 
-        auto createNetwork(std::shared_ptr<iroha::network::AsyncGrpcClient<
-                               google::protobuf::Empty>> async_call);
+        auto createNetwork(
+            std::shared_ptr<
+                iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
+                async_call,
+            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+            std::shared_ptr<iroha::network::ChannelPool> channel_pool);
 
         auto createCryptoProvider(
             const shared_model::crypto::Keypair &keypair,
             std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                common_objects_factory);
+                common_objects_factory,
+            std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+                verifier_pool);
 
         auto createTimer(std::chrono::milliseconds delay_milliseconds);
 
@@ -66,8 +73,12 @@ namespace iroha {
             std::shared_ptr<
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<iroha::network::ChannelPool> channel_pool,
+            std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
             std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                common_objects_factory);
+                common_objects_factory,
+            std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+                verifier_pool);
 
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -80,8 +91,11 @@ namespace iroha {
             std::shared_ptr<
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<iroha::network::ChannelPool> channel_pool,
             std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                common_objects_factory);
+                common_objects_factory,
+            std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+                verifier_pool);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
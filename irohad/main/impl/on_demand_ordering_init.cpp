@@ -44,19 +44,31 @@ namespace iroha {
     auto OnDemandOrderingInit::createNotificationFactory(
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<ChannelPool> channel_pool,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay) {
+      // batches are collected for a few milliseconds, which is short
+      // compared to the round, and sent over one stream per peer. Peers
+      // which do not implement the stream get batches with separate calls
+      ordering::transport::OnDemandOsBatchStream::Options stream_options{};
+      stream_options.window = std::chrono::milliseconds(5);
+      stream_options.max_transactions = 1000;
+      stream_options.timeout = std::chrono::seconds(10);
+
       return std::make_shared<ordering::transport::OnDemandOsClientGrpcFactory>(
           std::move(async_call),
           std::move(proposal_transport_factory),
           [] { return std::chrono::system_clock::now(); },
-          delay);
+          delay,
+          stream_options,
+          std::move(channel_pool));
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<ChannelPool> channel_pool,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes) {
@@ -158,6 +170,8 @@ namespace iroha {
          * v, round 1 - kNextRoundRejectConsumer
          * v, round 2 - kNextRoundCommitConsumer
          * o, round 0 - kIssuer
+         * x, round 1 - kNextRejectRoundIssuer
+         * x, round 0 - kNextCommitRoundIssuer
          */
         peers.peers.at(OnDemandConnectionManager::kCurrentRoundRejectConsumer) =
             getOsPeer(kCurrentRound,
@@ -169,6 +183,10 @@ namespace iroha {
             getOsPeer(kRoundAfterNext, ordering::kNextCommitRoundConsumer);
         peers.peers.at(OnDemandConnectionManager::kIssuer) =
             getOsPeer(kCurrentRound, current_round.reject_round);
+        peers.peers.at(OnDemandConnectionManager::kNextRejectRoundIssuer) =
+            getOsPeer(kCurrentRound, current_round.reject_round + 1);
+        peers.peers.at(OnDemandConnectionManager::kNextCommitRoundIssuer) =
+            getOsPeer(kNextRound, ordering::kFirstRejectRound);
         return peers;
       };
 
@@ -176,11 +194,19 @@ namespace iroha {
                        .with_latest_from(latest_hashes)
                        .map(map_peers);
 
+      // proposal request is repeated once, if there is no response during the
+      // first half of the timeout
+      ordering::OnDemandConnectionManager::RequestOptions options{};
+      options.hedge_delay = delay / 2;
+      options.prefetch = true;
+
       return std::make_shared<ordering::OnDemandConnectionManager>(
           createNotificationFactory(std::move(async_call),
+                                    std::move(channel_pool),
                                     std::move(proposal_transport_factory),
                                     delay),
-          peers);
+          peers,
+          options);
     }
 
     auto OnDemandOrderingInit::createGate(
@@ -242,9 +268,17 @@ namespace iroha {
         size_t max_size,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
-        std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache) {
+        std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+        std::shared_ptr<ordering::ProposalPackingPolicy> packing_policy,
+        size_t max_carried_over_batches) {
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
-          max_size, std::move(proposal_factory), std::move(tx_cache));
+          max_size,
+          std::move(proposal_factory),
+          std::move(tx_cache),
+          ordering::OnDemandOrderingServiceImpl::kDefaultNumberOfProposals,
+          consensus::Round{2, ordering::kFirstRejectRound},
+          std::move(packing_policy),
+          max_carried_over_batches);
     }
 
     OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -266,15 +300,21 @@ namespace iroha {
             transaction_batch_factory,
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<ChannelPool> channel_pool,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+        std::shared_ptr<ordering::ProposalPackingPolicy> packing_policy,
+        size_t max_carried_over_batches,
         consensus::Round initial_round,
         std::function<std::chrono::seconds(
             const synchronizer::SynchronizationEvent &)> delay_func) {
-      auto ordering_service =
-          createService(max_size, proposal_factory, tx_cache);
+      auto ordering_service = createService(max_size,
+                                            proposal_factory,
+                                            tx_cache,
+                                            std::move(packing_policy),
+                                            max_carried_over_batches);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
           std::move(transaction_factory),
@@ -284,6 +324,7 @@ namespace iroha {
           ordering_service,
           createConnectionManager(std::move(peer_query_factory),
                                   std::move(async_call),
+                                  std::move(channel_pool),
                                   std::move(proposal_transport_factory),
                                   delay,
                                   std::move(initial_hashes)),
@@ -13,11 +13,13 @@
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
+#include "ordering/impl/proposal_packing_policy.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/on_demand_os_transport.hpp"
 
@@ -42,6 +44,7 @@ namespace iroha {
       auto createNotificationFactory(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<ChannelPool> channel_pool,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay);
 
@@ -54,6 +57,7 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<ChannelPool> channel_pool,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes);
@@ -81,7 +85,9 @@ namespace iroha {
           size_t max_size,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
-          std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache);
+          std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+          std::shared_ptr<ordering::ProposalPackingPolicy> packing_policy,
+          size_t max_carried_over_batches);
 
      public:
       ~OnDemandOrderingInit();
@@ -103,8 +109,13 @@ namespace iroha {
        * batch candidates produced by parser
        * @param async_call asynchronous gRPC client required for sending batches
        * requests to ordering service and processing responses
+       * @param channel_pool channels to ordering services of peers
        * @param proposal_factory factory required by ordering service to produce
        * proposals
+       * @param packing_policy policy of ordering service which selects batches
+       * for proposals
+       * @param max_carried_over_batches number of batches which did not get
+       * into a proposal and are kept by ordering service for the next one
        * @param initial_round initial value for current round used in
        * OnDemandOrderingGate
        * @return initialized ordering gate
@@ -123,10 +134,13 @@ namespace iroha {
               transaction_batch_factory,
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<ChannelPool> channel_pool,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
+          std::shared_ptr<ordering::ProposalPackingPolicy> packing_policy,
+          size_t max_carried_over_batches,
           consensus::Round initial_round,
           std::function<std::chrono::seconds(
               const synchronizer::SynchronizationEvent &)> delay_func);
@@ -6,6 +6,7 @@
 #ifndef IROHA_CONF_LOADER_HPP
 #define IROHA_CONF_LOADER_HPP
 
+#include <algorithm>
 #include <fstream>
 #include <string>
 
@@ -26,6 +27,13 @@ namespace config_members {
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
   const char *MstSupport = "mst_enable";
+  const char *HotAssets = "hot_assets";
+  const char *BatchCommands = "batch_commands";
+  const char *ValidationThreads = "validation_threads";
+  const char *ToriiValidationThreads = "torii_validation_threads";
+  const char *ProposalPriorities = "proposal_priorities";
+  const char *ProposalCreatorQuota = "proposal_creator_quota";
+  const char *MaxCarriedOverBatches = "max_carried_over_batches";
 }  // namespace config_members
 
 static constexpr size_t kBadJsonPrintLength = 15;
@@ -61,6 +69,8 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
   const std::string kStrType = "string";
   const std::string kUintType = "uint";
   const std::string kBoolType = "bool";
+  const std::string kStrArrayType = "string array";
+  const std::string kIntObjectType = "object of int";
   doc.ParseStream(isw);
   ac::assert_fatal(not doc.HasParseError(),
                    reportJsonParsingError(doc, conf_path, ifs_iroha));
@@ -103,6 +113,52 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
                    ac::no_member_error(mbr::MstSupport));
   ac::assert_fatal(doc[mbr::MstSupport].IsBool(),
                    ac::type_error(mbr::MstSupport, kBoolType));
+
+  if (doc.HasMember(mbr::HotAssets)) {
+    const auto &hot_assets = doc[mbr::HotAssets];
+    ac::assert_fatal(
+        hot_assets.IsArray()
+            and std::all_of(hot_assets.Begin(),
+                            hot_assets.End(),
+                            [](const auto &asset) { return asset.IsString(); }),
+        ac::type_error(mbr::HotAssets, kStrArrayType));
+  }
+
+  if (doc.HasMember(mbr::BatchCommands)) {
+    ac::assert_fatal(doc[mbr::BatchCommands].IsBool(),
+                     ac::type_error(mbr::BatchCommands, kBoolType));
+  }
+
+  if (doc.HasMember(mbr::ValidationThreads)) {
+    ac::assert_fatal(doc[mbr::ValidationThreads].IsUint(),
+                     ac::type_error(mbr::ValidationThreads, kUintType));
+  }
+
+  if (doc.HasMember(mbr::ToriiValidationThreads)) {
+    ac::assert_fatal(doc[mbr::ToriiValidationThreads].IsUint(),
+                     ac::type_error(mbr::ToriiValidationThreads, kUintType));
+  }
+
+  if (doc.HasMember(mbr::ProposalPriorities)) {
+    const auto &priorities = doc[mbr::ProposalPriorities];
+    ac::assert_fatal(
+        priorities.IsObject()
+            and std::all_of(
+                    priorities.MemberBegin(),
+                    priorities.MemberEnd(),
+                    [](const auto &member) { return member.value.IsInt(); }),
+        ac::type_error(mbr::ProposalPriorities, kIntObjectType));
+  }
+
+  if (doc.HasMember(mbr::ProposalCreatorQuota)) {
+    ac::assert_fatal(doc[mbr::ProposalCreatorQuota].IsUint(),
+                     ac::type_error(mbr::ProposalCreatorQuota, kUintType));
+  }
+
+  if (doc.HasMember(mbr::MaxCarriedOverBatches)) {
+    ac::assert_fatal(doc[mbr::MaxCarriedOverBatches].IsUint(),
+                     ac::type_error(mbr::MaxCarriedOverBatches, kUintType));
+  }
   return doc;
 }
 
@@ -6,14 +6,18 @@
 #include <csignal>
 #include <fstream>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <gflags/gflags.h>
 #include <grpc++/grpc++.h>
+#include "ametsuchi/impl/storage_impl.hpp"
 #include "common/result.hpp"
 #include "crypto/keys_manager_impl.hpp"
 #include "main/application.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
 static const std::string kListenIp = "0.0.0.0";
 
@@ -138,6 +142,55 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // storage of the daemon is always created by StorageImpl
+  auto storage =
+      std::static_pointer_cast<iroha::ametsuchi::StorageImpl>(irohad.storage);
+  if (config.HasMember(mbr::HotAssets)) {
+    std::unordered_set<std::string> hot_assets;
+    for (const auto &asset : config[mbr::HotAssets].GetArray()) {
+      hot_assets.insert(asset.GetString());
+    }
+    storage->setHotAssets(std::move(hot_assets));
+  }
+
+  if (config.HasMember(mbr::BatchCommands)) {
+    storage->setCommandBatching(config[mbr::BatchCommands].GetBool());
+  }
+
+  if (config.HasMember(mbr::ValidationThreads)) {
+    irohad.setValidationConcurrency(config[mbr::ValidationThreads].GetUint());
+  }
+
+  if (config.HasMember(mbr::ToriiValidationThreads)) {
+    irohad.setToriiValidationThreads(
+        config[mbr::ToriiValidationThreads].GetUint());
+  }
+
+  std::shared_ptr<iroha::ordering::ProposalPackingPolicy> packing_policy =
+      std::make_shared<iroha::ordering::FifoPackingPolicy>();
+  if (config.HasMember(mbr::ProposalPriorities)
+      or config.HasMember(mbr::ProposalCreatorQuota)) {
+    std::unordered_map<std::string, int> priorities;
+    if (config.HasMember(mbr::ProposalPriorities)) {
+      for (const auto &member : config[mbr::ProposalPriorities].GetObject()) {
+        priorities.emplace(member.name.GetString(), member.value.GetInt());
+      }
+    }
+    size_t creator_quota = config.HasMember(mbr::ProposalCreatorQuota)
+        ? config[mbr::ProposalCreatorQuota].GetUint()
+        : 0;
+    packing_policy = std::make_shared<iroha::ordering::PriorityPackingPolicy>(
+        iroha::ordering::PriorityPackingPolicy::creatorPriority(
+            std::move(priorities)),
+        creator_quota);
+  }
+  irohad.setProposalPacking(
+      std::move(packing_policy),
+      config.HasMember(mbr::MaxCarriedOverBatches)
+          ? config[mbr::MaxCarriedOverBatches].GetUint()
+          : iroha::ordering::OnDemandOrderingServiceImpl::
+                kDefaultMaxCarriedOverBatches);
+
   /*
    * The logic implemented below is reflected in the following truth table.
    *
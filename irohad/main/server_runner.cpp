@@ -38,6 +38,12 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   builder.SetMaxReceiveMessageSize(INT_MAX);
   builder.SetMaxSendMessageSize(INT_MAX);
 
+  // peers keep idle connections alive with keepalive pings, which are
+  // accepted instead of closing the connection, @see network::ChannelPool
+  builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  builder.AddChannelArgument(
+      GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, 10000);
+
   serverInstance_ = builder.BuildAndStart();
   serverInstanceCV_.notify_one();
 
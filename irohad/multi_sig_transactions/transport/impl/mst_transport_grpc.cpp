@@ -22,7 +22,8 @@ using iroha::ConstRefState;
 void sendStateAsyncImpl(const shared_model::interface::Peer &to,
                         ConstRefState state,
                         const std::string &sender_key,
-                        AsyncGrpcClient<google::protobuf::Empty> &async_call);
+                        AsyncGrpcClient<google::protobuf::Empty> &async_call,
+                        ChannelPool &channel_pool);
 
 MstTransportGrpc::MstTransportGrpc(
     std::shared_ptr<AsyncGrpcClient<google::protobuf::Empty>> async_call,
@@ -32,13 +33,15 @@ MstTransportGrpc::MstTransportGrpc(
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
         transaction_batch_factory,
     std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
-    shared_model::crypto::PublicKey my_key)
+    shared_model::crypto::PublicKey my_key,
+    std::shared_ptr<ChannelPool> channel_pool)
     : async_call_(std::move(async_call)),
       transaction_factory_(std::move(transaction_factory)),
       batch_parser_(std::move(batch_parser)),
       batch_factory_(std::move(transaction_batch_factory)),
       tx_presence_cache_(std::move(tx_presence_cache)),
-      my_key_(shared_model::crypto::toBinaryString(my_key)) {}
+      my_key_(shared_model::crypto::toBinaryString(my_key)),
+      channel_pool_(std::move(channel_pool)) {}
 
 shared_model::interface::types::SharedTxsCollectionType
 MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
@@ -152,7 +155,8 @@ void MstTransportGrpc::subscribe(
 void MstTransportGrpc::sendState(const shared_model::interface::Peer &to,
                                  ConstRefState providing_state) {
   async_call_->log_->info("Propagate MstState to peer {}", to.address());
-  sendStateAsyncImpl(to, providing_state, my_key_, *async_call_);
+  sendStateAsyncImpl(
+      to, providing_state, my_key_, *async_call_, *channel_pool_);
 }
 
 void iroha::network::sendStateAsync(
@@ -160,17 +164,22 @@ void iroha::network::sendStateAsync(
     ConstRefState state,
     const shared_model::crypto::PublicKey &sender_key,
     AsyncGrpcClient<google::protobuf::Empty> &async_call) {
-  sendStateAsyncImpl(
-      to, state, shared_model::crypto::toBinaryString(sender_key), async_call);
+  // channels are shared by the calls of the function
+  static ChannelPool channel_pool;
+  sendStateAsyncImpl(to,
+                     state,
+                     shared_model::crypto::toBinaryString(sender_key),
+                     async_call,
+                     channel_pool);
 }
 
 void sendStateAsyncImpl(const shared_model::interface::Peer &to,
                         ConstRefState state,
                         const std::string &sender_key,
-                        AsyncGrpcClient<google::protobuf::Empty> &async_call) {
+                        AsyncGrpcClient<google::protobuf::Empty> &async_call,
+                        ChannelPool &channel_pool) {
   std::unique_ptr<transport::MstTransportGrpc::StubInterface> client =
-      transport::MstTransportGrpc::NewStub(grpc::CreateChannel(
-          to.address(), grpc::InsecureChannelCredentials()));
+      channel_pool.createClient<transport::MstTransportGrpc>(to.address());
 
   transport::MstState protoState;
   protoState.set_source_peer_key(sender_key);
@@ -183,7 +192,9 @@ void sendStateAsyncImpl(const shared_model::interface::Peer &to,
     }
   }
 
-  async_call.Call([&](auto context, auto cq) {
-    return client->AsyncSendState(context, protoState, cq);
-  });
+  async_call.Call(
+      [&](auto context, auto cq) {
+        return client->AsyncSendState(context, protoState, cq);
+      },
+      channel_pool.track<google::protobuf::Empty>(to.address()));
 }
@@ -16,6 +16,7 @@
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
 
 namespace iroha {
 
@@ -41,7 +42,9 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::TransactionBatchFactory>
               transaction_batch_factory,
           std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
-          shared_model::crypto::PublicKey my_key);
+          shared_model::crypto::PublicKey my_key,
+          std::shared_ptr<ChannelPool> channel_pool =
+              std::make_shared<ChannelPool>());
 
       /**
        * Server part of grpc SendState method call
@@ -79,6 +82,7 @@ namespace iroha {
       std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache_;
       /// source peer key for MST propogation messages
       const std::string my_key_;
+      std::shared_ptr<ChannelPool> channel_pool_;
     };
 
     void sendStateAsync(const shared_model::interface::Peer &to,
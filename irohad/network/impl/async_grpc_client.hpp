@@ -6,8 +6,15 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
 #include <thread>
+#include <vector>
 
+#include <boost/optional.hpp>
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
@@ -17,55 +24,93 @@ namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client, server responses are either ignored or passed
+     * to the callback of the call. Responses are processed by a pool of
+     * threads polling one completion queue, so callbacks may run
+     * concurrently
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(
-          logger::Logger log = logger::log("AsyncGrpcClient"))
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
+      using OnResponse =
+          std::function<void(const grpc::Status &, const Response &)>;
 
       /**
-       * Listen to gRPC server responses
+       * Parameters of the client
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-          if (not call->status.ok()) {
-            log_->warn("RPC failed: {}", call->status.error_message());
-          }
-          delete call;
+      struct Options {
+        /// number of threads processing responses
+        size_t threads;
+        /// maximum number of calls waiting for response, further calls are
+        /// rejected until some of them complete
+        size_t max_in_flight;
+        /// deadline of calls which do not set it themselves, so calls to
+        /// peers which stopped responding do not stay in flight forever
+        std::chrono::milliseconds call_timeout;
+      };
+
+      /**
+       * Counters of the client calls
+       */
+      struct Statistics {
+        /// calls waiting for response
+        size_t in_flight;
+        size_t completed;
+        /// completed calls with not ok status
+        size_t failed;
+        /// calls not started because of max_in_flight limit
+        size_t rejected;
+        /// moving average of latency of completed calls
+        std::chrono::microseconds latency;
+      };
+
+      static constexpr Options kDefaultOptions{
+          2, 10000, std::chrono::milliseconds(10000)};
+
+      explicit AsyncGrpcClient(
+          logger::Logger log = logger::log("AsyncGrpcClient"))
+          : AsyncGrpcClient(kDefaultOptions, std::move(log)) {}
+
+      explicit AsyncGrpcClient(
+          Options options, logger::Logger log = logger::log("AsyncGrpcClient"))
+          : log_(std::move(log)), options_(options) {
+        for (size_t i = 0; i < std::max<size_t>(options_.threads, 1); ++i) {
+          threads_.emplace_back(&AsyncGrpcClient::asyncCompleteRpc, this);
         }
       }
 
       ~AsyncGrpcClient() {
         cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+        for (auto &thread : threads_) {
+          if (thread.joinable()) {
+            thread.join();
+          }
         }
       }
 
       grpc::CompletionQueue cq_;
-      std::thread thread_;
       logger::Logger log_;
 
       /**
-       * State and data information of gRPC call
+       * State and data information of gRPC call, objects are reused by
+       * subsequent calls
        */
       struct AsyncClientCall {
         Response reply;
 
-        grpc::ClientContext context;
+        /// context can not be reset, so it is created for every call
+        boost::optional<grpc::ClientContext> context;
 
         grpc::Status status;
 
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
             response_reader;
+
+        /// called on completion of the call, if set
+        OnResponse on_response;
+
+        std::chrono::steady_clock::time_point start;
       };
 
       /**
@@ -75,11 +120,153 @@ namespace iroha {
        */
       template <typename F>
       void Call(F &&lambda) {
-        auto call = new AsyncClientCall;
-        call->response_reader = lambda(&call->context, &cq_);
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        Call(std::forward<F>(lambda), nullptr);
+      }
+
+      /**
+       * Perform a call and process the response
+       * @tparam lambda which must return unique pointer to
+       * ClientAsyncResponseReader<Response> object
+       * @param on_response - called with the status and the response on one
+       * of the threads of the client. If there are too many calls in flight,
+       * the call is not performed, and on_response is called immediately
+       * with RESOURCE_EXHAUSTED status
+       */
+      template <typename F>
+      void Call(F &&lambda, OnResponse on_response) {
+        if (in_flight_.fetch_add(1) >= options_.max_in_flight) {
+          in_flight_.fetch_sub(1);
+          {
+            std::lock_guard<std::mutex> lock(statistics_mutex_);
+            ++statistics_.rejected;
+          }
+          respond(on_response,
+                  grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                               "Too many calls in flight"),
+                  Response());
+          return;
+        }
+
+        auto call = acquire();
+        call->on_response = std::move(on_response);
+        call->start = std::chrono::steady_clock::now();
+        call->context.emplace();
+        call->context->set_deadline(std::chrono::system_clock::now()
+                                    + options_.call_timeout);
+        call->response_reader = lambda(&*call->context, &cq_);
+        auto tag = call.release();
+        tag->response_reader->Finish(&tag->reply, &tag->status, tag);
       }
+
+      /**
+       * @return counters of the client calls
+       */
+      Statistics statistics() const {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        auto statistics = statistics_;
+        statistics.in_flight = in_flight_.load();
+        return statistics;
+      }
+
+     private:
+      /// weight of the last call in the moving average of latency is
+      /// 1/kLatencyDecay
+      static constexpr int kLatencyDecay = 8;
+
+      /**
+       * Listen to gRPC server responses
+       */
+      void asyncCompleteRpc() {
+        void *got_tag;
+        auto ok = false;
+        while (cq_.Next(&got_tag, &ok)) {
+          std::unique_ptr<AsyncClientCall> call(
+              static_cast<AsyncClientCall *>(got_tag));
+          record(std::chrono::steady_clock::now() - call->start,
+                 call->status.ok());
+          respond(call->on_response, call->status, call->reply);
+          release(std::move(call));
+        }
+      }
+
+      void respond(const OnResponse &on_response,
+                   const grpc::Status &status,
+                   const Response &reply) {
+        if (on_response) {
+          on_response(status, reply);
+        } else if (not status.ok()) {
+          log_->warn("RPC failed: {}", status.error_message());
+        }
+      }
+
+      /**
+       * Update statistics with the completed call, which is not in flight
+       * anymore
+       */
+      void record(std::chrono::steady_clock::duration latency, bool ok) {
+        auto micros =
+            std::chrono::duration_cast<std::chrono::microseconds>(latency);
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        in_flight_.fetch_sub(1);
+        statistics_.latency = statistics_.completed == 0
+            ? micros
+            : statistics_.latency
+                + (micros - statistics_.latency) / kLatencyDecay;
+        ++statistics_.completed;
+        if (not ok) {
+          ++statistics_.failed;
+        }
+      }
+
+      /**
+       * @return call object from the pool, or a new one if there is none
+       */
+      std::unique_ptr<AsyncClientCall> acquire() {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        if (free_calls_.empty()) {
+          return std::make_unique<AsyncClientCall>();
+        }
+        auto call = std::move(free_calls_.back());
+        free_calls_.pop_back();
+        return call;
+      }
+
+      /**
+       * Clear the completed call and return it to the pool. Size of the pool
+       * is bounded by max_in_flight
+       */
+      void release(std::unique_ptr<AsyncClientCall> call) {
+        call->reply.Clear();
+        // the reader is allocated on the arena of the call, which is freed
+        // with the context, so it is destroyed first
+        call->response_reader.reset();
+        call->context = boost::none;
+        call->status = grpc::Status();
+        call->on_response = nullptr;
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        free_calls_.push_back(std::move(call));
+      }
+
+      const Options options_;
+
+      std::atomic<size_t> in_flight_{0};
+      Statistics statistics_{0, 0, 0, 0, std::chrono::microseconds(0)};
+      mutable std::mutex statistics_mutex_;
+
+      std::vector<std::unique_ptr<AsyncClientCall>> free_calls_;
+      std::mutex pool_mutex_;
+
+      /// started last, so the state above is initialized for them
+      std::vector<std::thread> threads_;
     };
+
+    template <typename Response>
+    constexpr typename AsyncGrpcClient<Response>::Options
+        AsyncGrpcClient<Response>::kDefaultOptions;
+
+    template <typename Response>
+    constexpr int AsyncGrpcClient<Response>::kLatencyDecay;
+
   }  // namespace network
 }  // namespace iroha
 
@@ -5,13 +5,10 @@
 
 #include "network/impl/block_loader_impl.hpp"
 
-#include <grpc++/create_channel.h>
-
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "common/bind.hpp"
 #include "interfaces/common_objects/peer.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
@@ -27,9 +24,11 @@ namespace {
 BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     shared_model::proto::ProtoBlockFactory factory,
+    std::shared_ptr<ChannelPool> channel_pool,
     logger::Logger log)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
+      channel_pool_(std::move(channel_pool)),
       log_(std::move(log)) {}
 
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
@@ -51,8 +50,9 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
         // request next block to our top
         request.set_height(height + 1);
 
-        auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
+        auto stub =
+            channel_pool_->createClient<proto::Loader>((*peer)->address());
+        auto reader = stub->retrieveBlocks(&context, request);
         while (reader->Read(&block)) {
           auto proto_block = block_factory_.createBlock(std::move(block));
           proto_block.match(
@@ -86,7 +86,14 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   // request block with specified hash
   request.set_hash(toBinaryString(block_hash));
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto address = (*peer)->address();
+  // failure is logged below
+  auto on_response = channel_pool_->track<protocol::Block>(
+      address, [](const auto &, const auto &) {});
+  auto status =
+      channel_pool_->createClient<proto::Loader>(address)->retrieveBlock(
+          &context, request, &block);
+  on_response(status, block);
   if (not status.ok()) {
     log_->warn(status.error_message());
     return boost::none;
@@ -125,16 +132,3 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   }
   return *it;
 }
-
-proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
-    const shared_model::interface::Peer &peer) {
-  auto it = peer_connections_.find(peer.address());
-  if (it == peer_connections_.end()) {
-    it = peer_connections_
-             .insert(std::make_pair(
-                 peer.address(),
-                 network::createClient<proto::Loader>(peer.address())))
-             .first;
-  }
-  return *it->second;
-}
@@ -8,12 +8,11 @@
 
 #include "network/block_loader.hpp"
 
-#include <unordered_map>
-
 #include "ametsuchi/peer_query_factory.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger.hpp"
+#include "network/impl/channel_pool.hpp"
 
 namespace iroha {
   namespace network {
@@ -22,6 +21,8 @@ namespace iroha {
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           shared_model::proto::ProtoBlockFactory factory,
+          std::shared_ptr<ChannelPool> channel_pool =
+              std::make_shared<ChannelPool>(),
           logger::Logger log = logger::log("BlockLoaderImpl"));
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -43,19 +44,9 @@ namespace iroha {
        */
       boost::optional<std::shared_ptr<shared_model::interface::Peer>> findPeer(
           const shared_model::crypto::PublicKey &pubkey);
-      /**
-       * Get or create a RPC stub for connecting to peer
-       * @param peer for connecting
-       * @return RPC stub
-       */
-      proto::Loader::Stub &getPeerStub(
-          const shared_model::interface::Peer &peer);
-
-      std::unordered_map<shared_model::interface::types::AddressType,
-                         std::unique_ptr<proto::Loader::Stub>>
-          peer_connections_;
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       shared_model::proto::ProtoBlockFactory block_factory_;
+      std::shared_ptr<ChannelPool> channel_pool_;
 
       logger::Logger log_;
     };
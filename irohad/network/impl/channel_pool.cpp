@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include <climits>
+#include <unordered_set>
+
+using namespace iroha::network;
+
+const ChannelPool::Options ChannelPool::kDefaultOptions{
+    std::chrono::seconds(30), std::chrono::seconds(10), 1 << 20};
+
+/// weight of the last call in the moving average of latency is 1/kLatencyDecay
+static constexpr int kLatencyDecay = 8;
+
+ChannelPool::ChannelPool(Options options, logger::Logger log)
+    : log_(std::move(log)) {
+  // in order to bypass built-in limitation of gRPC message size
+  arguments_.SetMaxSendMessageSize(INT_MAX);
+  arguments_.SetMaxReceiveMessageSize(INT_MAX);
+
+  arguments_.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, options.keepalive_time.count());
+  arguments_.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS,
+                    options.keepalive_timeout.count());
+  // connections are kept warm between rounds, when there are no calls
+  arguments_.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  arguments_.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+  arguments_.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES,
+                    options.stream_window_size);
+  arguments_.SetInt(GRPC_ARG_HTTP2_BDP_PROBE, 1);
+}
+
+std::shared_ptr<grpc::Channel> ChannelPool::getChannel(
+    const std::string &address) {
+  return peer(address).channel;
+}
+
+boost::optional<ChannelPool::PeerStatistics> ChannelPool::statistics(
+    const std::string &address) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = peers_.find(address);
+  if (it == peers_.end()) {
+    return boost::none;
+  }
+  return it->second.statistics->get();
+}
+
+void ChannelPool::retain(const std::vector<std::string> &addresses) {
+  std::unordered_set<std::string> retained(addresses.begin(),
+                                           addresses.end());
+  std::vector<std::string> evicted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = peers_.begin(); it != peers_.end();) {
+      if (retained.count(it->first) == 0) {
+        log_->info("Evict channel to {}", it->first);
+        evicted.push_back(it->first);
+        it = peers_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // subscribers are notified without the lock, so they can use the pool
+  if (not evicted.empty()) {
+    evicted_.get_subscriber().on_next(evicted);
+  }
+}
+
+rxcpp::observable<std::vector<std::string>> ChannelPool::onEvicted() const {
+  return evicted_.get_observable();
+}
+
+ChannelPool::Peer ChannelPool::peer(const std::string &address) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &peer = peers_[address];
+  if (not peer.channel) {
+    peer.channel = grpc::CreateCustomChannel(
+        address, grpc::InsecureChannelCredentials(), arguments_);
+    peer.statistics = std::make_shared<Statistics>();
+  }
+  return peer;
+}
+
+void ChannelPool::Statistics::record(
+    std::chrono::steady_clock::duration latency, bool ok) {
+  auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency);
+  std::lock_guard<std::mutex> lock(mutex_);
+  statistics_.latency = statistics_.calls == 0
+      ? micros
+      : statistics_.latency + (micros - statistics_.latency) / kLatencyDecay;
+  ++statistics_.calls;
+  if (ok) {
+    statistics_.consecutive_failures = 0;
+  } else {
+    ++statistics_.failures;
+    ++statistics_.consecutive_failures;
+  }
+}
+
+ChannelPool::PeerStatistics ChannelPool::Statistics::get() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return statistics_;
+}
@@ -0,0 +1,182 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHANNEL_POOL_HPP
+#define IROHA_CHANNEL_POOL_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <grpc++/grpc++.h>
+#include <rxcpp/rx.hpp>
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Channels to peers shared by all internal transports, so there is one
+     * warm connection per peer. Channels keep connections alive with
+     * keepalive pings, and outcomes of calls are collected to statistics of
+     * peers. Channels of peers which leave the network are evicted, stubs
+     * created before keep the channel until they are destroyed, and owners
+     * of other per-peer state are notified to drop it.
+     *
+     * Used by the transports of irohad to its peers: YAC, block loader, MST
+     * and on-demand ordering. Torii clients, which reach a peer from
+     * outside, and the legacy ordering transports create their own channels
+     */
+    class ChannelPool {
+     public:
+      /**
+       * Parameters of created channels
+       */
+      struct Options {
+        /// period of keepalive pings, servers should accept pings this often
+        std::chrono::milliseconds keepalive_time;
+        /// time to wait for acknowledgement of a ping before the connection
+        /// is considered broken
+        std::chrono::milliseconds keepalive_timeout;
+        /// HTTP/2 flow control window of a stream in bytes, which is grown
+        /// further by bandwidth estimation
+        int stream_window_size;
+      };
+
+      /**
+       * Outcomes of calls to a peer
+       */
+      struct PeerStatistics {
+        size_t calls;
+        size_t failures;
+        /// failures since the last successful call
+        size_t consecutive_failures;
+        /// moving average of call latency
+        std::chrono::microseconds latency;
+      };
+
+      /// call completion handler, @see AsyncGrpcClient
+      template <typename Response>
+      using OnResponse =
+          std::function<void(const grpc::Status &, const Response &)>;
+
+      static const Options kDefaultOptions;
+
+      explicit ChannelPool(Options options = kDefaultOptions,
+                           logger::Logger log = logger::log("ChannelPool"));
+
+      /**
+       * Get channel to the peer, it is created if there is none
+       * @param address - address of the peer, ipv4:port
+       * @return channel to the peer
+       */
+      std::shared_ptr<grpc::Channel> getChannel(const std::string &address);
+
+      /**
+       * Create stub of the service on the channel to the peer
+       * @tparam T type for gRPC stub, e.g. proto::Yac
+       * @param address - address of the peer, ipv4:port
+       * @return gRPC stub of parametrized type
+       */
+      template <typename T>
+      auto createClient(const std::string &address) {
+        return T::NewStub(getChannel(address));
+      }
+
+      /**
+       * Create handler of a call to the peer which is started now, the
+       * handler records the outcome to statistics of the peer
+       * @tparam Response - type of server response
+       * @param address - address of the peer, ipv4:port
+       * @param on_response - handler of the call, failures are logged if it
+       * is not set
+       * @return handler to pass to AsyncGrpcClient::Call, or to call after
+       * a synchronous call
+       */
+      template <typename Response>
+      OnResponse<Response> track(const std::string &address,
+                                 OnResponse<Response> on_response = nullptr) {
+        auto start = std::chrono::steady_clock::now();
+        auto statistics = peer(address).statistics;
+        auto log = log_;
+        return [start,
+                statistics = std::move(statistics),
+                on_response = std::move(on_response),
+                address,
+                log = std::move(log)](const grpc::Status &status,
+                                      const Response &response) {
+          statistics->record(std::chrono::steady_clock::now() - start,
+                             status.ok());
+          if (on_response) {
+            on_response(status, response);
+          } else if (not status.ok()) {
+            log->warn("RPC to {} failed: {}", address, status.error_message());
+          }
+        };
+      }
+
+      /**
+       * @param address - address of the peer, ipv4:port
+       * @return statistics of calls to the peer, none if it is not in the
+       * pool
+       */
+      boost::optional<PeerStatistics> statistics(
+          const std::string &address) const;
+
+      /**
+       * Remove channels of peers which are not in the list
+       * @param addresses - addresses of peers in the network
+       */
+      void retain(const std::vector<std::string> &addresses);
+
+      /**
+       * @return addresses of peers evicted by each retain call, emitted on
+       * the thread of the call when there are any
+       */
+      rxcpp::observable<std::vector<std::string>> onEvicted() const;
+
+     private:
+      /**
+       * Statistics of a peer updated by completed calls
+       */
+      class Statistics {
+       public:
+        void record(std::chrono::steady_clock::duration latency, bool ok);
+
+        PeerStatistics get() const;
+
+       private:
+        mutable std::mutex mutex_;
+        PeerStatistics statistics_{0, 0, 0, std::chrono::microseconds(0)};
+      };
+
+      struct Peer {
+        std::shared_ptr<grpc::Channel> channel;
+        std::shared_ptr<Statistics> statistics;
+      };
+
+      /**
+       * Get the peer entry, it is created if there is none
+       */
+      Peer peer(const std::string &address);
+
+      grpc::ChannelArguments arguments_;
+      logger::Logger log_;
+
+      std::unordered_map<std::string, Peer> peers_;
+      mutable std::mutex mutex_;
+
+      rxcpp::subjects::subject<std::vector<std::string>> evicted_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHANNEL_POOL_HPP
@@ -6,6 +6,7 @@
 #include "ordering/impl/on_demand_connection_manager.hpp"
 
 #include <boost/range/combine.hpp>
+#include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
@@ -15,6 +16,7 @@ using namespace iroha::ordering;
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
+    RequestOptions options,
     logger::Logger log)
     : log_(std::move(log)),
       factory_(std::move(factory)),
@@ -23,14 +25,17 @@ OnDemandConnectionManager::OnDemandConnectionManager(
         std::lock_guard<std::shared_timed_mutex> lock(mutex_);
 
         this->initializeConnections(peers);
-      })) {}
+      })),
+      options_(std::move(options)) {}
 
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
     CurrentPeers initial_peers,
+    RequestOptions options,
     logger::Logger log)
-    : OnDemandConnectionManager(std::move(factory), peers, std::move(log)) {
+    : OnDemandConnectionManager(
+          std::move(factory), peers, std::move(options), std::move(log)) {
   // using start_with(initial_peers) results in deadlock
   initializeConnections(initial_peers);
 }
@@ -77,11 +82,96 @@ OnDemandConnectionManager::onRequestProposal(consensus::Round round) {
 
   log_->debug("onRequestProposal, {}", round);
 
-  return connections_.peers[kIssuer]->onRequestProposal(round);
+  std::shared_ptr<ProposalRequest> request;
+  {
+    std::lock_guard<std::mutex> guard(prefetched_mutex_);
+    auto it = prefetched_.find(round);
+    if (it != prefetched_.end()
+        and *it->second->issuer == *current_peers_.peers[kIssuer]) {
+      request = it->second;
+    }
+    prefetched_.clear();
+  }
+
+  if (request) {
+    std::unique_lock<std::mutex> guard(request->mutex);
+    // proposal could be requested before the issuer packed it
+    if (request->done and not request->proposal) {
+      request.reset();
+    }
+  }
+  if (request) {
+    log_->debug("Using prefetched request for {}", round);
+  } else {
+    request = sendRequest(kIssuer, round);
+  }
+
+  boost::optional<ProposalType> proposal;
+  {
+    std::unique_lock<std::mutex> guard(request->mutex);
+    auto done = [&request] { return request->done; };
+    if (options_.hedge_delay
+        and not request->received.wait_for(
+                guard, *options_.hedge_delay, done)) {
+      log_->info("No proposal for {} after {} ms, repeating request",
+                 round,
+                 options_.hedge_delay->count());
+      guard.unlock();
+      sendRequest(kIssuer, round, request);
+      guard.lock();
+    }
+    request->received.wait(guard, done);
+    proposal = std::move(request->proposal);
+  }
+
+  if (options_.prefetch) {
+    std::lock_guard<std::mutex> guard(prefetched_mutex_);
+    consensus::Round reject_round{round.block_round, round.reject_round + 1};
+    consensus::Round commit_round{round.block_round + 1, kFirstRejectRound};
+    prefetched_.emplace(reject_round,
+                        sendRequest(kNextRejectRoundIssuer, reject_round));
+    prefetched_.emplace(commit_round,
+                        sendRequest(kNextCommitRoundIssuer, commit_round));
+  }
+
+  return proposal;
+}
+
+std::shared_ptr<OnDemandConnectionManager::ProposalRequest>
+OnDemandConnectionManager::sendRequest(
+    PeerType type,
+    consensus::Round round,
+    std::shared_ptr<ProposalRequest> request) {
+  if (not request) {
+    request = std::make_shared<ProposalRequest>();
+    request->issuer = current_peers_.peers[type];
+  }
+  {
+    std::lock_guard<std::mutex> guard(request->mutex);
+    ++request->pending;
+  }
+
+  connections_.peers[type]->requestProposal(
+      round, [request](boost::optional<ProposalType> proposal) {
+        {
+          std::lock_guard<std::mutex> guard(request->mutex);
+          --request->pending;
+          if (request->done) {
+            return;
+          }
+          if (proposal) {
+            request->proposal = std::move(proposal);
+          }
+          request->done = request->proposal or request->pending == 0;
+        }
+        request->received.notify_all();
+      });
+  return request;
 }
 
 void OnDemandConnectionManager::initializeConnections(
     const CurrentPeers &peers) {
+  current_peers_ = peers;
   auto create_assign = [this](auto &ptr, auto &peer) {
     ptr = factory_->create(*peer);
   };
@@ -8,7 +8,11 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <rxcpp/rx.hpp>
 #include "logger/logger.hpp"
@@ -27,12 +31,17 @@ namespace iroha {
        * reject round for current block, reject round for next block, and
        * commit for subsequent next round
        * Proposal is requested from the current ordering service: issuer
+       * Proposals of the rounds following the current one are prefetched from
+       * their issuers: reject round for current block, commit round for next
+       * block
        */
       enum PeerType {
         kCurrentRoundRejectConsumer = 0,
         kNextRoundRejectConsumer,
         kNextRoundCommitConsumer,
         kIssuer,
+        kNextRejectRoundIssuer,
+        kNextCommitRoundIssuer,
         kCount
       };
 
@@ -49,15 +58,28 @@ namespace iroha {
             peers;
       };
 
+      /**
+       * Options of proposal requests
+       */
+      struct RequestOptions {
+        /// request is repeated if there is no response after the delay
+        boost::optional<std::chrono::milliseconds> hedge_delay;
+        /// request proposals of the possible next rounds in advance, value
+        /// initialized options do not prefetch
+        bool prefetch;
+      };
+
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
+          RequestOptions options = RequestOptions{},
           logger::Logger log = logger::log("OnDemandConnectionManager"));
 
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
           CurrentPeers initial_peers,
+          RequestOptions options = RequestOptions{},
           logger::Logger log = logger::log("OnDemandConnectionManager"));
 
       ~OnDemandConnectionManager() override;
@@ -68,6 +90,30 @@ namespace iroha {
           consensus::Round round) override;
 
      private:
+      /**
+       * Proposal requests of a round which may be sent to several peers, the
+       * first received proposal is the result
+       */
+      struct ProposalRequest {
+        /// issuer of the round at the moment of sending
+        std::shared_ptr<shared_model::interface::Peer> issuer;
+        std::mutex mutex;
+        std::condition_variable received;
+        size_t pending = 0;
+        bool done = false;
+        boost::optional<ProposalType> proposal;
+      };
+
+      /**
+       * Send proposal request to the peer of given type
+       * @param request - request to join, new one is created if null
+       * Note: requires shared lock of mutex_
+       */
+      std::shared_ptr<ProposalRequest> sendRequest(
+          PeerType type,
+          consensus::Round round,
+          std::shared_ptr<ProposalRequest> request = nullptr);
+
       /**
        * Corresponding connections created by OdOsNotificationFactory
        * @see PeerType for individual descriptions
@@ -87,8 +133,18 @@ namespace iroha {
       rxcpp::composite_subscription subscription_;
 
       CurrentConnections connections_;
+      CurrentPeers current_peers_;
 
       std::shared_timed_mutex mutex_;
+
+      RequestOptions options_;
+
+      /// requests of proposals for the possible next rounds
+      std::unordered_map<consensus::Round,
+                         std::shared_ptr<ProposalRequest>,
+                         consensus::RoundTypeHasher>
+          prefetched_;
+      std::mutex prefetched_mutex_;
     };
 
   }  // namespace ordering
@@ -5,18 +5,47 @@
 
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 
+#include <algorithm>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/empty.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/visitor.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 
+namespace {
+  /**
+   * Check whether the ordering services a batch was sent to can not
+   * propose it anymore, see OnDemandConnectionManager::onBatches. Without
+   * commits only the consumer in the current block round can be reached, so
+   * the batch expires once that one is passed, e.g. when its issuer is down
+   * and the network produces only reject rounds
+   * @param sent - round in which the batch was sent
+   * @param current - current round
+   * @return true if the batch has to be sent again
+   */
+  bool deliveryExpired(const consensus::Round &sent,
+                       const consensus::Round &current) {
+    const consensus::Round consumers[] = {
+        {sent.block_round, currentRejectRoundConsumer(sent.reject_round)},
+        {sent.block_round + 1, kNextRejectRoundConsumer},
+        {sent.block_round + 2, kNextCommitRoundConsumer}};
+    return std::none_of(std::begin(consumers),
+                        std::end(consumers),
+                        [&current](const auto &consumer) {
+                          return consumer.block_round == current.block_round
+                              and not(consumer < current);
+                        });
+  }
+}  // namespace
+
 OnDemandOrderingGate::OnDemandOrderingGate(
     std::shared_ptr<OnDemandOrderingService> ordering_service,
     std::shared_ptr<transport::OdOsNotification> network_client,
@@ -47,22 +76,15 @@ OnDemandOrderingGate::OnDemandOrderingGate(
                        });
         log_->debug("Current: {}", current_round_);
 
-        auto batches = cache_->pop();
-
-        cache_->addToBack(batches);
-        if (not batches.empty()) {
-          network_client_->onBatches(
-              current_round_,
-              transport::OdOsNotification::CollectionType{batches.begin(),
-                                                          batches.end()});
-        }
-
         // notify our ordering service about new round
         ordering_service_->onCollaborationOutcome(current_round_);
 
         // request proposal for the current round
-        auto proposal = this->processProposalRequest(
-            network_client_->onRequestProposal(current_round_));
+        auto received = network_client_->onRequestProposal(current_round_);
+
+        this->resendBatches(received);
+
+        auto proposal = this->processProposalRequest(std::move(received));
         // vote for the object received from the network
         proposal_notifier_.get_subscriber().on_next(
             network::OrderingEvent{proposal, current_round_});
@@ -81,6 +103,10 @@ void OnDemandOrderingGate::propagateBatch(
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
 
   cache_->addToBack({batch});
+  {
+    std::lock_guard<std::mutex> sent_lock(sent_rounds_mutex_);
+    sent_rounds_[batch] = current_round_;
+  }
   network_client_->onBatches(
       current_round_, transport::OdOsNotification::CollectionType{batch});
 }
@@ -95,6 +121,52 @@ void OnDemandOrderingGate::setPcs(
       "Method is deprecated. PCS observable should be set in ctor");
 }
 
+void OnDemandOrderingGate::resendBatches(
+    const boost::optional<OnDemandOrderingService::ProposalType> &proposal) {
+  auto batches = cache_->pop();
+  cache_->addToBack(batches);
+
+  // transactions which the ordering service of the current round holds
+  cache::OrderingGateCache::HashesSetType proposed;
+  if (proposal) {
+    for (const auto &tx : proposal.value()->transactions()) {
+      proposed.insert(tx.hash());
+    }
+  }
+  auto is_proposed = [&proposed](const auto &batch) {
+    const auto &txs = batch->transactions();
+    return not proposed.empty() and not txs.empty()
+        and std::all_of(txs.begin(), txs.end(), [&proposed](const auto &tx) {
+             return proposed.count(tx->hash()) != 0;
+           });
+  };
+
+  transport::OdOsNotification::CollectionType missing;
+  {
+    std::lock_guard<std::mutex> lock(sent_rounds_mutex_);
+    for (auto it = sent_rounds_.begin(); it != sent_rounds_.end();) {
+      it = it->first.expired() ? sent_rounds_.erase(it) : std::next(it);
+    }
+
+    for (const auto &batch : batches) {
+      auto sent = sent_rounds_.find(batch);
+      auto expired = sent == sent_rounds_.end()
+          or deliveryExpired(sent->second, current_round_);
+      if (expired and not is_proposed(batch)) {
+        sent_rounds_[batch] = current_round_;
+        missing.push_back(batch);
+      }
+    }
+  }
+  log_->debug("Resending {} of {} cached batches",
+              missing.size(),
+              batches.size());
+
+  if (not missing.empty()) {
+    network_client_->onBatches(current_round_, std::move(missing));
+  }
+}
+
 boost::optional<std::shared_ptr<shared_model::interface::Proposal>>
 OnDemandOrderingGate::processProposalRequest(
     boost::optional<OnDemandOrderingService::ProposalType> &&proposal) const {
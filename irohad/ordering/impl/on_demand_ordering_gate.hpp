@@ -8,6 +8,8 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <map>
+#include <mutex>
 #include <shared_mutex>
 
 #include <boost/variant.hpp>
@@ -77,6 +79,16 @@ namespace iroha {
           const iroha::network::PeerCommunicationService &pcs) override;
 
      private:
+      /**
+       * Send batches from the head of the cache which are not held by the
+       * ordering services anymore
+       * @param proposal - proposal of the current round, the ordering service
+       * holds its batches
+       */
+      void resendBatches(
+          const boost::optional<OnDemandOrderingService::ProposalType>
+              &proposal);
+
       /**
        * Handle an incoming proposal from ordering service
        */
@@ -101,6 +113,16 @@ namespace iroha {
       std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache_;
 
       consensus::Round current_round_;
+
+      /// rounds in which the cached batches were sent to the ordering
+      /// services, entries of batches which left the cache expire
+      std::map<std::weak_ptr<shared_model::interface::TransactionBatch>,
+               consensus::Round,
+               std::owner_less<
+                   std::weak_ptr<shared_model::interface::TransactionBatch>>>
+          sent_rounds_;
+      std::mutex sent_rounds_mutex_;
+
       rxcpp::subjects::subject<network::OrderingEvent> proposal_notifier_;
       mutable std::shared_timed_mutex mutex_;
     };
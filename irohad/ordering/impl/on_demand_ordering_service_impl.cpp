@@ -5,9 +5,10 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <unordered_set>
 
-#include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
@@ -23,6 +24,9 @@
 using namespace iroha;
 using namespace iroha::ordering;
 
+constexpr size_t OnDemandOrderingServiceImpl::kDefaultNumberOfProposals;
+constexpr size_t OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverBatches;
+
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
@@ -30,13 +34,27 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     size_t number_of_proposals,
     const consensus::Round &initial_round,
+    std::shared_ptr<ProposalPackingPolicy> packing_policy,
+    size_t max_carried_over_batches,
     logger::Logger log)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
+      packing_policy_(std::move(packing_policy)),
+      max_carried_over_batches_(max_carried_over_batches),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       log_(std::move(log)) {
   onCollaborationOutcome(initial_round);
+  pre_filter_thread_ = std::thread([this] { preFilterLoop(); });
+}
+
+OnDemandOrderingServiceImpl::~OnDemandOrderingServiceImpl() {
+  {
+    std::lock_guard<std::mutex> guard(pending_mutex_);
+    stop_ = true;
+  }
+  pending_cv_.notify_all();
+  pre_filter_thread_.join();
 }
 
 // -------------------------| OnDemandOrderingService |-------------------------
@@ -44,47 +62,40 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
 void OnDemandOrderingServiceImpl::onCollaborationOutcome(
     consensus::Round round) {
   log_->info("onCollaborationOutcome => {}", round);
-  // exclusive write lock
-  std::lock_guard<std::shared_timed_mutex> guard(lock_);
-  log_->debug("onCollaborationOutcome => write lock is acquired");
+  std::lock_guard<std::mutex> outcome_guard(outcome_mutex_);
 
   packNextProposals(round);
+
+  // exclusive write lock
+  std::lock_guard<std::shared_timed_mutex> guard(lock_);
   tryErase();
 }
 
+boost::optional<OnDemandOrderingService::ProposalBlobType>
+OnDemandOrderingServiceImpl::onRequestProposalBlob(consensus::Round round) {
+  // read lock
+  std::shared_lock<std::shared_timed_mutex> guard(lock_);
+  auto proposal = proposal_map_.find(round);
+  log_->debug("onRequestProposalBlob, {}, {}returning a proposal.",
+              round,
+              (proposal == proposal_map_.end()) ? "NOT " : "");
+  if (proposal == proposal_map_.end()) {
+    return boost::none;
+  }
+  // the blob is owned by the proposal, which is kept alive by the pointer
+  return ProposalBlobType(proposal->second, &proposal->second->blob());
+}
+
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(consensus::Round round,
                                             CollectionType batches) {
-  // read lock
-  std::shared_lock<std::shared_timed_mutex> guard(lock_);
   log_->info("onBatches => collection size = {}, {}", batches.size(), round);
-
-  auto unprocessed_batches =
-      boost::adaptors::filter(batches, [this](const auto &batch) {
-        log_->info("check batch {} for already processed transactions",
-                   batch->reducedHash().hex());
-        return not this->batchAlreadyProcessed(*batch);
-      });
-  auto it = current_proposals_.find(round);
-  if (it == current_proposals_.end()) {
-    it =
-        std::find_if(current_proposals_.begin(),
-                     current_proposals_.end(),
-                     [&round](const auto &p) {
-                       auto request_reject_round = round.reject_round;
-                       auto reject_round = p.first.reject_round;
-                       return request_reject_round == reject_round
-                           or (request_reject_round >= 2 and reject_round >= 2);
-                     });
-    BOOST_ASSERT_MSG(it != current_proposals_.end(),
-                     "No place to store the batches!");
-    log_->debug("onBatches => collection will be inserted to {}", it->first);
-  }
-  std::for_each(unprocessed_batches.begin(),
-                unprocessed_batches.end(),
-                [&it](auto &obj) { it->second.push(std::move(obj)); });
-  log_->debug("onBatches => collection is inserted");
+  {
+    std::lock_guard<std::mutex> guard(pending_mutex_);
+    pending_.push_back({round, std::move(batches)});
+  }
+  pending_cv_.notify_one();
 }
 
 boost::optional<OnDemandOrderingServiceImpl::ProposalType>
@@ -104,21 +115,125 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
   }
 }
 
+size_t OnDemandOrderingServiceImpl::droppedBatchesCount() const {
+  return dropped_batches_;
+}
+
+size_t OnDemandOrderingServiceImpl::carriedOverBatchesCount() const {
+  return carried_over_batches_;
+}
+
 // ---------------------------------| Private |---------------------------------
 
+void OnDemandOrderingServiceImpl::preFilterLoop() {
+  while (true) {
+    std::deque<PendingBatches> pending;
+    size_t generation;
+    {
+      std::unique_lock<std::mutex> lock(pending_mutex_);
+      pending_cv_.wait(lock, [this] { return stop_ or not pending_.empty(); });
+      if (pending_.empty()) {
+        return;
+      }
+      pending.swap(pending_);
+      generation = ++taken_generation_;
+    }
+
+    storeBatches(std::move(pending));
+
+    {
+      std::lock_guard<std::mutex> guard(pending_mutex_);
+      stored_generation_ = generation;
+    }
+    stored_cv_.notify_all();
+  }
+}
+
+void OnDemandOrderingServiceImpl::flushPreFilter() {
+  std::deque<PendingBatches> pending;
+  size_t generation;
+  {
+    std::lock_guard<std::mutex> guard(pending_mutex_);
+    pending.swap(pending_);
+    generation = taken_generation_;
+  }
+
+  storeBatches(std::move(pending));
+
+  // batches taken later by the pre-filter thread are not waited for
+  std::unique_lock<std::mutex> lock(pending_mutex_);
+  stored_cv_.wait(
+      lock, [this, generation] { return stored_generation_ >= generation; });
+}
+
+void OnDemandOrderingServiceImpl::storeBatches(
+    std::deque<PendingBatches> pending) {
+  if (pending.empty()) {
+    return;
+  }
+
+  // storage is queried without holding any lock, once for each batch
+  std::unordered_map<std::string, bool> processed;
+  for (auto &entry : pending) {
+    auto unprocessed = std::remove_if(
+        entry.batches.begin(),
+        entry.batches.end(),
+        [this, &processed](const auto &batch) {
+          auto hash = batch->reducedHash().hex();
+          auto it = processed.find(hash);
+          if (it == processed.end()) {
+            log_->info("check batch {} for already processed transactions",
+                       hash);
+            it = processed
+                     .emplace(std::move(hash),
+                              this->batchAlreadyProcessed(*batch))
+                     .first;
+          }
+          return it->second;
+        });
+    entry.batches.erase(unprocessed, entry.batches.end());
+  }
+
+  std::lock_guard<std::mutex> guard(rounds_mutex_);
+  for (auto &entry : pending) {
+    const auto &round = entry.round;
+    auto it = current_proposals_.find(round);
+    if (it == current_proposals_.end()) {
+      it = std::find_if(
+          current_proposals_.begin(),
+          current_proposals_.end(),
+          [&round](const auto &p) {
+            auto request_reject_round = round.reject_round;
+            auto reject_round = p.first.reject_round;
+            return request_reject_round == reject_round
+                or (request_reject_round >= 2 and reject_round >= 2);
+          });
+      BOOST_ASSERT_MSG(it != current_proposals_.end(),
+                       "No place to store the batches!");
+      log_->debug("onBatches => collection will be inserted to {}",
+                  it->first);
+    }
+    std::move(entry.batches.begin(),
+              entry.batches.end(),
+              std::back_inserter(it->second));
+  }
+  log_->debug("onBatches => collection is inserted");
+}
+
 void OnDemandOrderingServiceImpl::packNextProposals(
     const consensus::Round &round) {
-  auto close_round = [this](consensus::Round round) {
+  // batches received before the outcome get into the closed rounds
+  flushPreFilter();
+
+  std::vector<std::pair<consensus::Round, std::vector<TransactionBatchType>>>
+      closed_rounds;
+  auto close_round = [this, &closed_rounds](consensus::Round round) {
     log_->debug("close {}", round);
 
     auto it = current_proposals_.find(round);
     if (it != current_proposals_.end()) {
       log_->debug("proposal found");
-      if (not it->second.empty()) {
-        proposal_map_.emplace(round, emitProposal(round));
-        log_->debug("packNextProposal: data has been fetched for {}", round);
-        round_queue_.push(round);
-      }
+      closed_rounds.emplace_back(round, std::move(it->second));
       current_proposals_.erase(it);
     }
   };
@@ -159,6 +274,8 @@ void OnDemandOrderingServiceImpl::packNextProposals(
    * (1,0) - current round. The diagram is similar to the initial case.
    */
 
+  std::unique_lock<std::mutex> rounds_lock(rounds_mutex_);
+
   // close next reject round
   close_round({round.block_round, round.reject_round + 1});
 
@@ -176,32 +293,92 @@ void OnDemandOrderingServiceImpl::packNextProposals(
   // new reject round
   open_round(
       {round.block_round, currentRejectRoundConsumer(round.reject_round)});
+
+  // batches for the new rounds are received while proposals are packed
+  rounds_lock.unlock();
+
+  for (auto &closed_round : closed_rounds) {
+    if (closed_round.second.empty() and carried_over_.empty()) {
+      continue;
+    }
+    if (auto proposal =
+            emitProposal(closed_round.first, std::move(closed_round.second))) {
+      // exclusive write lock
+      std::lock_guard<std::shared_timed_mutex> guard(lock_);
+      proposal_map_.emplace(closed_round.first, std::move(*proposal));
+      log_->debug("packNextProposal: data has been fetched for {}",
+                  closed_round.first);
+      round_queue_.push(closed_round.first);
+    }
+  }
 }
 
-OnDemandOrderingServiceImpl::ProposalType
-OnDemandOrderingServiceImpl::emitProposal(const consensus::Round &round) {
+boost::optional<OnDemandOrderingServiceImpl::ProposalType>
+OnDemandOrderingServiceImpl::emitProposal(
+    const consensus::Round &round, std::vector<TransactionBatchType> batches) {
   log_->debug("Mutable proposal generation, {}", round);
 
-  TransactionBatchType batch;
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
+  std::vector<ProposalPackingPolicy::Candidate> candidates;
   std::unordered_set<std::string> inserted;
+  size_t oversized = 0;
+  auto add_candidate = [&](ProposalPackingPolicy::Candidate candidate) {
+    // a batch which does not fit any proposal would be carried over forever
+    if (candidate.batch->transactions().size() > transaction_limit_) {
+      log_->warn("Batch {} with {} transactions exceeds the proposal limit",
+                 candidate.batch->reducedHash().hex(),
+                 candidate.batch->transactions().size());
+      ++oversized;
+      return;
+    }
+    if (inserted.insert(candidate.batch->reducedHash().hex()).second) {
+      candidates.push_back(std::move(candidate));
+    }
+  };
+
+  // carried over batches arrived before the batches of the round, though
+  // they could be committed in the meantime with a proposal of another peer
+  for (auto &candidate : carried_over_) {
+    if (not batchAlreadyProcessed(*candidate.batch)) {
+      add_candidate(std::move(candidate));
+    }
+  }
+  carried_over_.clear();
 
-  // outer method should guarantee availability of at least one transaction in
-  // queue, also, code shouldn't fetch all transactions from queue. The rest
-  // will be lost.
-  auto &current_proposal = current_proposals_[round];
-  while (current_proposal.try_pop(batch)
-         and collection.size() < transaction_limit_
-         and inserted.insert(batch->reducedHash().hex()).second) {
-    collection.insert(
-        std::end(collection),
-        std::make_move_iterator(std::begin(batch->transactions())),
-        std::make_move_iterator(std::end(batch->transactions())));
+  for (auto &batch : batches) {
+    add_candidate({std::move(batch), 0});
+  }
+
+  auto packing = packing_policy_->pack(std::move(candidates),
+                                       transaction_limit_);
+
+  // policy puts the most preferred batches first, so the tail is dropped
+  auto carried_over =
+      std::min(packing.rest.size(), max_carried_over_batches_);
+  std::for_each(packing.rest.begin(),
+                packing.rest.begin() + carried_over,
+                [this](auto &candidate) {
+                  ++candidate.age;
+                  carried_over_.push_back(std::move(candidate));
+                });
+  auto dropped = packing.rest.size() - carried_over + oversized;
+  carried_over_batches_ += carried_over;
+  dropped_batches_ += dropped;
+
+  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
+  for (const auto &packed : packing.packed) {
+    collection.insert(std::end(collection),
+                      std::begin(packed->transactions()),
+                      std::end(packed->transactions()));
   }
   log_->debug("Number of transactions in proposal = {}", collection.size());
-  log_->debug("Number of lost transactions = {}",
-              current_proposal.unsafe_size());
+  log_->debug("Number of carried over batches = {}", carried_over);
+  if (dropped != 0) {
+    log_->warn("Number of dropped batches = {}", dropped);
+  }
 
+  if (collection.empty()) {
+    return boost::none;
+  }
   auto txs = collection | boost::adaptors::indirected;
   return proposal_factory_->unsafeCreateProposal(
       round.block_round, iroha::time::now(), txs);
@@ -8,22 +8,36 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
+#include <thread>
 #include <unordered_map>
 
-#include <tbb/concurrent_queue.h>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/proposal_packing_policy.hpp"
 
 namespace iroha {
   namespace ametsuchi {
     class TxPresenceCache;
   }
   namespace ordering {
+    /**
+     * Received batches go through a pre-filter stage on a separate thread,
+     * which drops already processed batches and stores the rest into the
+     * rounds. So receiving batches waits neither for the storage nor for
+     * packing of proposals
+     */
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      static constexpr size_t kDefaultNumberOfProposals = 3;
+      static constexpr size_t kDefaultMaxCarriedOverBatches = 1024;
+
       /**
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
@@ -34,6 +48,10 @@ namespace iroha {
        * removed. Default value is 3
        * @param initial_round - first round of agreement.
        * Default value is {2, kFirstRejectRound} since genesis block height is 1
+       * @param packing_policy - selects batches for proposals. Default policy
+       * packs batches in order of their arrival
+       * @param max_carried_over_batches - number of batches which did not get
+       * into a proposal and are kept for the next one, the rest is dropped
        * @param log to print progress
        */
       OnDemandOrderingServiceImpl(
@@ -41,14 +59,22 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
-          size_t number_of_proposals = 3,
+          size_t number_of_proposals = kDefaultNumberOfProposals,
           const consensus::Round &initial_round = {2, kFirstRejectRound},
+          std::shared_ptr<ProposalPackingPolicy> packing_policy =
+              std::make_shared<FifoPackingPolicy>(),
+          size_t max_carried_over_batches = kDefaultMaxCarriedOverBatches,
           logger::Logger log = logger::log("OnDemandOrderingServiceImpl"));
 
+      ~OnDemandOrderingServiceImpl() override;
+
       // --------------------- | OnDemandOrderingService |_---------------------
 
       void onCollaborationOutcome(consensus::Round round) override;
 
+      boost::optional<ProposalBlobType> onRequestProposalBlob(
+          consensus::Round round) override;
+
       // ----------------------- | OdOsNotification | --------------------------
 
       void onBatches(consensus::Round, CollectionType batches) override;
@@ -56,7 +82,45 @@ namespace iroha {
       boost::optional<ProposalType> onRequestProposal(
           consensus::Round round) override;
 
+      /**
+       * @return number of batches which did not get into proposals and were
+       * dropped since the service start, including batches larger than the
+       * transaction limit
+       */
+      size_t droppedBatchesCount() const;
+
+      /**
+       * @return number of times batches were carried over to the next
+       * proposal since the service start
+       */
+      size_t carriedOverBatchesCount() const;
+
      private:
+      /**
+       * Batches received for a round
+       */
+      struct PendingBatches {
+        consensus::Round round;
+        CollectionType batches;
+      };
+
+      /**
+       * Pre-filter stage loop, runs until the service is destroyed
+       */
+      void preFilterLoop();
+
+      /**
+       * Run all pending batches through the pre-filter stage and wait until
+       * the pre-filter thread stores the batches it has already taken
+       */
+      void flushPreFilter();
+
+      /**
+       * Drop already processed batches and store the rest into their rounds.
+       * Batches received several times are checked against the storage once
+       */
+      void storeBatches(std::deque<PendingBatches> pending);
+
       /**
        * Packs new proposals and creates new rounds
        * Note: method is not thread-safe
@@ -71,10 +135,14 @@ namespace iroha {
       void tryErase();
 
       /**
-       * @return packed proposal from the given round queue
+       * Pack a proposal from the batches of the round and batches carried
+       * over from the previous proposals
+       * @return packed proposal, none if no batches were selected
        * Note: method is not thread-safe
        */
-      ProposalType emitProposal(const consensus::Round &round);
+      boost::optional<ProposalType> emitProposal(
+          const consensus::Round &round,
+          std::vector<TransactionBatchType> batches);
 
       /**
        * Check if batch was already processed by the peer
@@ -98,26 +166,78 @@ namespace iroha {
       std::queue<consensus::Round> round_queue_;
 
       /**
-       * Map of available proposals
+       * Map of available proposals, which are shared with the requests of
+       * serialized proposals
        */
-      std::unordered_map<consensus::Round,
-                         ProposalType,
-                         consensus::RoundTypeHasher>
+      std::unordered_map<
+          consensus::Round,
+          std::shared_ptr<const shared_model::interface::Proposal>,
+          consensus::RoundTypeHasher>
           proposal_map_;
 
       /**
        * Proposals for current rounds
        */
       std::unordered_map<consensus::Round,
-                         tbb::concurrent_queue<TransactionBatchType>,
+                         std::vector<TransactionBatchType>,
                          consensus::RoundTypeHasher>
           current_proposals_;
 
       /**
-       * Read write mutex for public methods
+       * Mutex for current rounds, it is held only to store batches or to
+       * switch rounds, not while proposals are packed
+       */
+      std::mutex rounds_mutex_;
+
+      /**
+       * Batches waiting for the pre-filter stage
+       */
+      std::deque<PendingBatches> pending_;
+
+      /**
+       * Number of times the pre-filter thread took pending batches, and the
+       * last of them which is already stored
+       */
+      size_t taken_generation_ = 0;
+      size_t stored_generation_ = 0;
+
+      bool stop_ = false;
+
+      std::mutex pending_mutex_;
+      std::condition_variable pending_cv_;
+      std::condition_variable stored_cv_;
+
+      /**
+       * Selects batches for proposals
+       */
+      std::shared_ptr<ProposalPackingPolicy> packing_policy_;
+
+      /**
+       * Max number of batches kept for the next proposal
+       */
+      size_t max_carried_over_batches_;
+
+      /**
+       * Batches which did not get into the previous proposal
+       */
+      std::vector<ProposalPackingPolicy::Candidate> carried_over_;
+
+      /**
+       * Counters of dropped and carried over batches
+       */
+      std::atomic<size_t> dropped_batches_{0};
+      std::atomic<size_t> carried_over_batches_{0};
+
+      /**
+       * Read write mutex for available proposals
        */
       std::shared_timed_mutex lock_;
 
+      /**
+       * Serializes collaboration outcomes
+       */
+      std::mutex outcome_mutex_;
+
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
 
@@ -130,6 +250,8 @@ namespace iroha {
        * Logger instance
        */
       logger::Logger log_;
+
+      std::thread pre_filter_thread_;
     };
   }  // namespace ordering
 }  // namespace iroha
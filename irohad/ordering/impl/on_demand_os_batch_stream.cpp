@@ -0,0 +1,175 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/on_demand_os_batch_stream.hpp"
+
+#include <algorithm>
+
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+OnDemandOsBatchStream::OnDemandOsBatchStream(
+    std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+    Options options,
+    FallbackType fallback,
+    logger::Logger log)
+    : stub_(std::move(stub)),
+      options_(options),
+      fallback_(std::move(fallback)),
+      log_(std::move(log)),
+      thread_(&OnDemandOsBatchStream::sendLoop, this),
+      watchdog_(&OnDemandOsBatchStream::watchdogLoop, this) {}
+
+OnDemandOsBatchStream::~OnDemandOsBatchStream() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+    if (context_) {
+      context_->TryCancel();
+    }
+  }
+  cv_.notify_one();
+  watchdog_cv_.notify_one();
+  thread_.join();
+  watchdog_.join();
+}
+
+void OnDemandOsBatchStream::send(proto::BatchesRequest request) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (unsupported_) {
+    lock.unlock();
+    fallback_(std::move(request));
+    return;
+  }
+  pending_transactions_ += request.transactions_size();
+  auto it = std::find_if(
+      pending_.begin(), pending_.end(), [&request](const auto &pending) {
+        return pending.round().block_round() == request.round().block_round()
+            and pending.round().reject_round()
+            == request.round().reject_round();
+      });
+  if (it == pending_.end()) {
+    if (pending_.empty()) {
+      window_end_ = std::chrono::steady_clock::now() + options_.window;
+    }
+    pending_.push_back(std::move(request));
+  } else {
+    for (auto &transaction : *request.mutable_transactions()) {
+      *it->add_transactions() = std::move(transaction);
+    }
+  }
+  cv_.notify_one();
+}
+
+void OnDemandOsBatchStream::sendLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return stop_ or not pending_.empty(); });
+    cv_.wait_until(lock, window_end_, [this] {
+      return stop_ or pending_transactions_ >= options_.max_transactions;
+    });
+    if (stop_) {
+      break;
+    }
+    auto requests = std::move(pending_);
+    pending_.clear();
+    pending_transactions_ = 0;
+    lock.unlock();
+
+    for (auto &request : requests) {
+      if (log_->should_log(spdlog::level::debug)) {
+        log_->debug("Propagating: '{}'", request.DebugString());
+      }
+      write(std::move(request));
+    }
+
+    lock.lock();
+  }
+  lock.unlock();
+  closeStream();
+}
+
+void OnDemandOsBatchStream::watchdogLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    watchdog_cv_.wait(lock, [this] { return stop_ or waiting_ack_; });
+    if (stop_) {
+      break;
+    }
+    auto deadline = ack_deadline_;
+    if (not watchdog_cv_.wait_until(lock, deadline, [this, deadline] {
+          return stop_ or not waiting_ack_ or ack_deadline_ != deadline;
+        })) {
+      log_->warn("Batch stream is not acknowledged in time, cancelling");
+      waiting_ack_ = false;
+      if (context_) {
+        context_->TryCancel();
+      }
+    }
+  }
+}
+
+void OnDemandOsBatchStream::write(proto::BatchesRequest request) {
+  bool unsupported;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) {
+      return;
+    }
+    unsupported = unsupported_;
+    if (not unsupported) {
+      if (not stream_) {
+        context_ = std::make_unique<grpc::ClientContext>();
+      }
+      ack_deadline_ = std::chrono::steady_clock::now() + options_.timeout;
+      waiting_ack_ = true;
+    }
+  }
+  if (unsupported) {
+    fallback_(std::move(request));
+    return;
+  }
+  watchdog_cv_.notify_one();
+
+  if (not stream_) {
+    stream_ = stub_->SendBatchesStream(context_.get());
+  }
+  google::protobuf::Empty ack;
+  auto acknowledged = stream_->Write(request) and stream_->Read(&ack);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    waiting_ack_ = false;
+  }
+  watchdog_cv_.notify_one();
+  if (acknowledged) {
+    return;
+  }
+
+  auto status = closeStream();
+  if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+    log_->info("Peer does not implement batch stream, using separate calls");
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      unsupported_ = true;
+    }
+    fallback_(std::move(request));
+    return;
+  }
+  log_->warn("Batch stream failed: {}, {} transactions are dropped",
+             status.error_message(),
+             request.transactions_size());
+}
+
+grpc::Status OnDemandOsBatchStream::closeStream() {
+  if (not stream_) {
+    return grpc::Status::OK;
+  }
+  stream_->WritesDone();
+  auto status = stream_->Finish();
+  stream_.reset();
+  std::lock_guard<std::mutex> lock(mutex_);
+  context_.reset();
+  return status;
+}
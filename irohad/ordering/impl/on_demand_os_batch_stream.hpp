@@ -0,0 +1,137 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ON_DEMAND_OS_BATCH_STREAM_HPP
+#define IROHA_ON_DEMAND_OS_BATCH_STREAM_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "logger/logger.hpp"
+#include "ordering.grpc.pb.h"
+
+namespace iroha {
+  namespace ordering {
+    namespace transport {
+
+      /**
+       * Long-lived stream of batches to the ordering service of one peer.
+       * Batches are collected over a short window and sent with one message
+       * per round, the next message is sent when the previous one is
+       * acknowledged, so batches coalesce while the peer is busy. The stream
+       * is reopened with the next message after a failure. Peers which do not
+       * implement the stream get batches with separate calls instead
+       */
+      class OnDemandOsBatchStream {
+       public:
+        /**
+         * Coalescing window of the stream
+         */
+        struct Options {
+          /// time batches are collected for before they are sent
+          std::chrono::milliseconds window;
+          /// number of transactions which are sent at once without waiting
+          /// for the end of the window
+          size_t max_transactions;
+          /// time to wait for the acknowledgement of a message, the stream is
+          /// cancelled after it, so a stalled peer does not block the stream
+          std::chrono::milliseconds timeout;
+        };
+
+        /// sends the request with a separate call
+        using FallbackType = std::function<void(proto::BatchesRequest)>;
+
+        /**
+         * @param fallback - used for all requests after the peer responds
+         * that it does not implement the stream
+         */
+        OnDemandOsBatchStream(
+            std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+            Options options,
+            FallbackType fallback,
+            logger::Logger log = logger::log("OnDemandOsBatchStream"));
+
+        ~OnDemandOsBatchStream();
+
+        /**
+         * Queue transactions of the request, they are sent together with
+         * other transactions of the same round
+         * @param request - transactions of a round
+         */
+        void send(proto::BatchesRequest request);
+
+       private:
+        /**
+         * Sending loop, runs until the stream is destroyed
+         */
+        void sendLoop();
+
+        /**
+         * Cancel the stream when an acknowledgement is not received in time,
+         * runs until the stream is destroyed
+         */
+        void watchdogLoop();
+
+        /**
+         * Write the request to the stream and wait for its acknowledgement.
+         * The stream is opened if required and closed on failure, in which
+         * case transactions of the request are dropped, unless the peer does
+         * not implement the stream
+         */
+        void write(proto::BatchesRequest request);
+
+        /**
+         * Finish the call of the stream if there is one
+         * @return status of the call
+         */
+        grpc::Status closeStream();
+
+        std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
+        Options options_;
+        FallbackType fallback_;
+        logger::Logger log_;
+
+        /**
+         * Requests waiting to be sent, one per round
+         */
+        std::vector<proto::BatchesRequest> pending_;
+        size_t pending_transactions_ = 0;
+        std::chrono::steady_clock::time_point window_end_;
+        bool stop_ = false;
+        /// the peer responded that it does not implement the stream
+        bool unsupported_ = false;
+
+        /// deadline of the acknowledgement of the message being written
+        std::chrono::steady_clock::time_point ack_deadline_;
+        bool waiting_ack_ = false;
+
+        /**
+         * Guards the state above and the context of the call, which is
+         * cancelled to stop the stream
+         */
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::condition_variable watchdog_cv_;
+
+        std::unique_ptr<grpc::ClientContext> context_;
+        std::unique_ptr<grpc::ClientReaderWriterInterface<
+            proto::BatchesRequest,
+            google::protobuf::Empty>>
+            stream_;
+
+        std::thread thread_;
+        std::thread watchdog_;
+      };
+
+    }  // namespace transport
+  }    // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ON_DEMAND_OS_BATCH_STREAM_HPP
@@ -5,30 +5,76 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <future>
+
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+namespace {
+  /**
+   * Build proposal from the response of proposal request
+   * @return proposal if the call succeeded and the response contains a
+   * correct proposal, none otherwise
+   */
+  boost::optional<OdOsNotification::ProposalType> buildProposal(
+      const grpc::Status &status,
+      const proto::ProposalResponse &response,
+      consensus::Round round,
+      OnDemandOsClientGrpc::TransportFactoryType &proposal_factory,
+      const logger::Logger &log) {
+    if (not status.ok()) {
+      log->warn("RPC failed: {}", status.error_message());
+      return boost::none;
+    }
+    if (not response.has_proposal()) {
+      return boost::none;
+    }
+    protocol::Proposal proposal;
+    if (not proposal.ParseFromString(response.proposal())) {
+      log->warn("Failed to parse proposal for {}", round);
+      return boost::none;
+    }
+    return proposal_factory.build(std::move(proposal))
+        .match(
+            [&](iroha::expected::Value<
+                std::unique_ptr<shared_model::interface::Proposal>> &v)
+                -> boost::optional<OdOsNotification::ProposalType> {
+              return OdOsNotification::ProposalType{std::move(v).value};
+            },
+            [&log](iroha::expected::Error<
+                   OnDemandOsClientGrpc::TransportFactoryType::Error> &error)
+                -> boost::optional<OdOsNotification::ProposalType> {
+              log->info(error.error.error);  // error
+              return {};
+            });
+  }
+}  // namespace
+
 OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
         async_call,
+    std::shared_ptr<network::AsyncGrpcClient<proto::ProposalResponse>>
+        proposal_async_call,
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
+    std::shared_ptr<OnDemandOsBatchStream> batch_stream,
     logger::Logger log)
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
+      proposal_async_call_(std::move(proposal_async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      batch_stream_(std::move(batch_stream)) {}
 
 void OnDemandOsClientGrpc::onBatches(consensus::Round round,
                                      CollectionType batches) {
@@ -43,7 +89,14 @@ void OnDemandOsClientGrpc::onBatches(consensus::Round round,
     }
   }
 
-  log_->debug("Propagating: '{}'", request.DebugString());
+  if (batch_stream_) {
+    batch_stream_->send(std::move(request));
+    return;
+  }
+
+  if (log_->should_log(spdlog::level::debug)) {
+    log_->debug("Propagating: '{}'", request.DebugString());
+  }
 
   async_call_->Call([&](auto context, auto cq) {
     return stub_->AsyncSendBatches(context, request, cq);
@@ -52,32 +105,37 @@ void OnDemandOsClientGrpc::onBatches(consensus::Round round,
 
 boost::optional<OdOsNotification::ProposalType>
 OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
-  grpc::ClientContext context;
-  context.set_deadline(time_provider_() + proposal_request_timeout_);
+  std::promise<boost::optional<ProposalType>> result;
+  auto future = result.get_future();
+  requestProposal(round, [&result](boost::optional<ProposalType> proposal) {
+    result.set_value(std::move(proposal));
+  });
+  return future.get();
+}
+
+void OnDemandOsClientGrpc::requestProposal(consensus::Round round,
+                                           ProposalCallbackType callback) {
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
-  proto::ProposalResponse response;
-  auto status = stub_->RequestProposal(&context, request, &response);
-  if (not status.ok()) {
-    log_->warn("RPC failed: {}", status.error_message());
-    return boost::none;
-  }
-  if (not response.has_proposal()) {
-    return boost::none;
-  }
-  return proposal_factory_->build(response.proposal())
-      .match(
-          [&](iroha::expected::Value<
-              std::unique_ptr<shared_model::interface::Proposal>> &v)
-              -> boost::optional<OdOsNotification::ProposalType> {
-            return ProposalType{std::move(v).value};
-          },
-          [this](iroha::expected::Error<TransportFactoryType::Error> &error)
-              -> boost::optional<OdOsNotification::ProposalType> {
-            log_->info(error.error.error);  // error
-            return {};
-          });
+  auto deadline = time_provider_() + proposal_request_timeout_;
+
+  // the client can be destroyed before the response is received, so the
+  // callback does not refer to it
+  proposal_async_call_->Call(
+      [&](auto context, auto cq) {
+        context->set_deadline(deadline);
+        return stub_->AsyncRequestProposal(context, request, cq);
+      },
+      [round,
+       proposal_factory = proposal_factory_,
+       log = log_,
+       callback = std::move(callback)](
+          const grpc::Status &status,
+          const proto::ProposalResponse &response) {
+        callback(
+            buildProposal(status, response, round, *proposal_factory, log));
+      });
 }
 
 OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
@@ -85,19 +143,70 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
         async_call,
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
-    OnDemandOsClientGrpc::TimeoutType proposal_request_timeout)
+    OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
+    boost::optional<OnDemandOsBatchStream::Options> batch_stream_options,
+    std::shared_ptr<network::ChannelPool> channel_pool)
     : async_call_(std::move(async_call)),
+      proposal_async_call_(std::make_shared<
+                           network::AsyncGrpcClient<proto::ProposalResponse>>(
+          logger::log("OnDemandOsProposalRequests"))),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      batch_stream_options_(std::move(batch_stream_options)),
+      channel_pool_(std::move(channel_pool)) {
+  evicted_subscription_ = channel_pool_->onEvicted().subscribe(
+      [this](const std::vector<std::string> &addresses) {
+        std::vector<std::shared_ptr<OnDemandOsBatchStream>> evicted;
+        {
+          std::lock_guard<std::mutex> lock(batch_streams_mutex_);
+          for (const auto &address : addresses) {
+            auto it = batch_streams_.find(address);
+            if (it != batch_streams_.end()) {
+              evicted.push_back(std::move(it->second));
+              batch_streams_.erase(it);
+            }
+          }
+        }
+        // streams are stopped without the lock, since stopping waits for
+        // the message being sent
+      });
+}
+
+OnDemandOsClientGrpcFactory::~OnDemandOsClientGrpcFactory() {
+  evicted_subscription_.unsubscribe();
+}
 
 std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
+  std::shared_ptr<OnDemandOsBatchStream> batch_stream;
+  if (batch_stream_options_) {
+    std::lock_guard<std::mutex> lock(batch_streams_mutex_);
+    auto &stream = batch_streams_[to.address()];
+    if (not stream) {
+      std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub =
+          channel_pool_->createClient<proto::OnDemandOrdering>(to.address());
+      // peers which do not implement the stream get batches with separate
+      // calls, the stream remembers the peer as long as it is kept
+      stream = std::make_shared<OnDemandOsBatchStream>(
+          channel_pool_->createClient<proto::OnDemandOrdering>(to.address()),
+          *batch_stream_options_,
+          [async_call = async_call_, stub](proto::BatchesRequest request) {
+            async_call->Call([&](auto context, auto cq) {
+              return stub->AsyncSendBatches(context, request, cq);
+            });
+          });
+    }
+    batch_stream = stream;
+  }
+
   return std::make_unique<OnDemandOsClientGrpc>(
-      network::createClient<proto::OnDemandOrdering>(to.address()),
+      channel_pool_->createClient<proto::OnDemandOrdering>(to.address()),
       async_call_,
+      proposal_async_call_,
       proposal_factory_,
       time_provider_,
       proposal_request_timeout_,
+      std::move(batch_stream),
       logger::log("OnDemandOsClientGrpc"));
 }
@@ -8,9 +8,15 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/on_demand_os_batch_stream.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -31,14 +37,22 @@ namespace iroha {
         /**
          * Constructor is left public because testing required passing a mock
          * stub interface
+         * @param async_call - client which sends batches
+         * @param proposal_async_call - client which requests proposals
+         * @param batch_stream - stream which sends batches instead of
+         * separate calls if present
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<
+                network::AsyncGrpcClient<proto::ProposalResponse>>
+                proposal_async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
+            std::shared_ptr<OnDemandOsBatchStream> batch_stream = nullptr,
             logger::Logger log = logger::log("OnDemandOsClientGrpc"));
 
         void onBatches(consensus::Round round, CollectionType batches) override;
@@ -46,30 +60,51 @@ namespace iroha {
         boost::optional<ProposalType> onRequestProposal(
             consensus::Round round) override;
 
+        /**
+         * Send proposal request on the completion queue of proposal requests,
+         * callback is called on the thread of the queue
+         */
+        void requestProposal(consensus::Round round,
+                             ProposalCallbackType callback) override;
+
        private:
         logger::Logger log_;
         std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
+        std::shared_ptr<network::AsyncGrpcClient<proto::ProposalResponse>>
+            proposal_async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        std::shared_ptr<OnDemandOsBatchStream> batch_stream_;
       };
 
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
        public:
         using TransportFactoryType = OnDemandOsClientGrpc::TransportFactoryType;
+
+        /**
+         * @param batch_stream_options - coalescing window of batch streams,
+         * batches are sent with separate calls if none
+         * @param channel_pool - channels to peers
+         */
         OnDemandOsClientGrpcFactory(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
-            OnDemandOsClientGrpc::TimeoutType proposal_request_timeout);
+            OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
+            boost::optional<OnDemandOsBatchStream::Options>
+                batch_stream_options = boost::none,
+            std::shared_ptr<network::ChannelPool> channel_pool =
+                std::make_shared<network::ChannelPool>());
+
+        ~OnDemandOsClientGrpcFactory() override;
 
         /**
-         * Create connection with insecure gRPC channel defined by
-         * network::createClient method
-         * @see network/impl/grpc_channel_builder.hpp
+         * Create connection on the channel to the peer from the channel pool
+         * @see network/impl/channel_pool.hpp
          * This factory method can be used in production code
          */
         std::unique_ptr<OdOsNotification> create(
@@ -78,9 +113,21 @@ namespace iroha {
        private:
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
+        /// proposal requests of all peers share one completion queue
+        std::shared_ptr<network::AsyncGrpcClient<proto::ProposalResponse>>
+            proposal_async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        boost::optional<OnDemandOsBatchStream::Options> batch_stream_options_;
+        std::shared_ptr<network::ChannelPool> channel_pool_;
+
+        /// connections are recreated every round, while batch streams are
+        /// kept for the peer address until its channel is evicted
+        std::unordered_map<std::string, std::shared_ptr<OnDemandOsBatchStream>>
+            batch_streams_;
+        std::mutex batch_streams_mutex_;
+        rxcpp::composite_subscription evicted_subscription_;
       };
 
     }  // namespace transport
@@ -9,15 +9,15 @@
 
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include "backend/protobuf/proposal.hpp"
 #include "common/bind.hpp"
+#include "cryptography/blob.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
 OnDemandOsServerGrpc::OnDemandOsServerGrpc(
-    std::shared_ptr<OdOsNotification> ordering_service,
+    std::shared_ptr<OnDemandOrderingService> ordering_service,
     std::shared_ptr<TransportFactoryType> transaction_factory,
     std::shared_ptr<shared_model::interface::TransactionBatchParser>
         batch_parser,
@@ -60,10 +60,8 @@ OnDemandOsServerGrpc::deserializeTransactions(
         }));
 }
 
-grpc::Status OnDemandOsServerGrpc::SendBatches(
-    ::grpc::ServerContext *context,
-    const proto::BatchesRequest *request,
-    ::google::protobuf::Empty *response) {
+void OnDemandOsServerGrpc::onBatchesRequest(
+    const proto::BatchesRequest *request) {
   consensus::Round round{request->round().block_round(),
                          request->round().reject_round()};
   auto transactions = deserializeTransactions(request);
@@ -86,7 +84,33 @@ grpc::Status OnDemandOsServerGrpc::SendBatches(
       });
 
   ordering_service_->onBatches(round, std::move(batches));
+}
+
+grpc::Status OnDemandOsServerGrpc::SendBatches(
+    ::grpc::ServerContext *context,
+    const proto::BatchesRequest *request,
+    ::google::protobuf::Empty *response) {
+  onBatchesRequest(request);
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OnDemandOsServerGrpc::SendBatchesStream(
+    ::grpc::ServerContext *context,
+    ::grpc::ServerReaderWriter<::google::protobuf::Empty,
+                               proto::BatchesRequest> *stream) {
+  return processBatchesStream(stream);
+}
 
+grpc::Status OnDemandOsServerGrpc::processBatchesStream(
+    ::grpc::ServerReaderWriterInterface<::google::protobuf::Empty,
+                                        proto::BatchesRequest> *stream) {
+  proto::BatchesRequest request;
+  while (stream->Read(&request)) {
+    onBatchesRequest(&request);
+    if (not stream->Write(::google::protobuf::Empty{})) {
+      break;
+    }
+  }
   return ::grpc::Status::OK;
 }
 
@@ -94,12 +118,11 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
     ::grpc::ServerContext *context,
     const proto::ProposalRequest *request,
     proto::ProposalResponse *response) {
-  ordering_service_->onRequestProposal(
+  ordering_service_->onRequestProposalBlob(
       {request->round().block_round(), request->round().reject_round()})
-      | [&](auto &&proposal) {
-          *response->mutable_proposal() = std::move(
-              static_cast<shared_model::proto::Proposal *>(proposal.get())
-                  ->getTransport());
+      | [&](auto &&blob) {
+          const auto &bytes = blob->blob();
+          response->set_proposal(bytes.data(), bytes.size());
         };
   return ::grpc::Status::OK;
 }
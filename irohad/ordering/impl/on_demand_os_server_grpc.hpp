@@ -6,7 +6,7 @@
 #ifndef IROHA_ON_DEMAND_OS_TRANSPORT_SERVER_GRPC_HPP
 #define IROHA_ON_DEMAND_OS_TRANSPORT_SERVER_GRPC_HPP
 
-#include "ordering/on_demand_os_transport.hpp"
+#include "ordering/on_demand_ordering_service.hpp"
 
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
@@ -29,7 +29,7 @@ namespace iroha {
                 iroha::protocol::Transaction>;
 
         OnDemandOsServerGrpc(
-            std::shared_ptr<OdOsNotification> ordering_service,
+            std::shared_ptr<OnDemandOrderingService> ordering_service,
             std::shared_ptr<TransportFactoryType> transaction_factory,
             std::shared_ptr<shared_model::interface::TransactionBatchParser>
                 batch_parser,
@@ -41,6 +41,22 @@ namespace iroha {
                                  const proto::BatchesRequest *request,
                                  ::google::protobuf::Empty *response) override;
 
+        grpc::Status SendBatchesStream(
+            ::grpc::ServerContext *context,
+            ::grpc::ServerReaderWriter<::google::protobuf::Empty,
+                                       proto::BatchesRequest> *stream)
+            override;
+
+        /**
+         * Pass batches of every request of the stream to the ordering
+         * service and acknowledge the request, until the client closes the
+         * stream
+         */
+        grpc::Status processBatchesStream(
+            ::grpc::ServerReaderWriterInterface<::google::protobuf::Empty,
+                                                proto::BatchesRequest>
+                *stream);
+
         grpc::Status RequestProposal(
             ::grpc::ServerContext *context,
             const proto::ProposalRequest *request,
@@ -53,7 +69,13 @@ namespace iroha {
         shared_model::interface::types::SharedTxsCollectionType
         deserializeTransactions(const proto::BatchesRequest *request);
 
-        std::shared_ptr<OdOsNotification> ordering_service_;
+        /**
+         * Deserialize batches of the request and pass them to the ordering
+         * service
+         */
+        void onBatchesRequest(const proto::BatchesRequest *request);
+
+        std::shared_ptr<OnDemandOrderingService> ordering_service_;
 
         std::shared_ptr<TransportFactoryType> transaction_factory_;
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policy.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+ProposalPackingPolicy::Packing FifoPackingPolicy::pack(
+    std::vector<Candidate> candidates, size_t transaction_limit) const {
+  Packing packing;
+  size_t transactions = 0;
+  for (auto &candidate : candidates) {
+    auto size = candidate.batch->transactions().size();
+    if (transactions + size <= transaction_limit) {
+      transactions += size;
+      packing.packed.push_back(std::move(candidate.batch));
+    } else {
+      packing.rest.push_back(std::move(candidate));
+    }
+  }
+  return packing;
+}
+
+PriorityPackingPolicy::PriorityPackingPolicy(PriorityFunction priority,
+                                             size_t creator_quota)
+    : priority_(std::move(priority)), creator_quota_(creator_quota) {}
+
+PriorityPackingPolicy::PriorityFunction PriorityPackingPolicy::creatorPriority(
+    std::unordered_map<std::string, int> priorities) {
+  return [priorities = std::move(priorities)](
+             const shared_model::interface::TransactionBatch &batch) {
+    auto result = std::numeric_limits<int>::min();
+    for (const auto &tx : batch.transactions()) {
+      auto it = priorities.find(tx->creatorAccountId());
+      result = std::max(result, it == priorities.end() ? 0 : it->second);
+    }
+    return batch.transactions().empty() ? 0 : result;
+  };
+}
+
+ProposalPackingPolicy::Packing PriorityPackingPolicy::pack(
+    std::vector<Candidate> candidates, size_t transaction_limit) const {
+  // keys are computed once, arrival order breaks the remaining ties
+  std::vector<std::tuple<int, size_t, size_t, size_t>> keys;
+  keys.reserve(candidates.size());
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    keys.emplace_back(-priority_(*candidates[i].batch),
+                      std::numeric_limits<size_t>::max() - candidates[i].age,
+                      candidates[i].batch->transactions().size(),
+                      i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  Packing packing;
+  size_t transactions = 0;
+  std::unordered_map<std::string, size_t> creator_transactions;
+  for (const auto &key : keys) {
+    auto &candidate = candidates[std::get<3>(key)];
+    const auto &txs = candidate.batch->transactions();
+
+    auto fits = transactions + txs.size() <= transaction_limit;
+    if (fits and creator_quota_ != 0) {
+      std::unordered_map<std::string, size_t> batch_creators;
+      for (const auto &tx : txs) {
+        ++batch_creators[tx->creatorAccountId()];
+      }
+      fits = std::all_of(
+          batch_creators.begin(),
+          batch_creators.end(),
+          [this, &creator_transactions](const auto &creator) {
+            return creator_transactions[creator.first] + creator.second
+                <= creator_quota_;
+          });
+      if (fits) {
+        for (const auto &creator : batch_creators) {
+          creator_transactions[creator.first] += creator.second;
+        }
+      }
+    }
+
+    if (fits) {
+      transactions += txs.size();
+      packing.packed.push_back(std::move(candidate.batch));
+    } else {
+      packing.rest.push_back(std::move(candidate));
+    }
+  }
+  return packing;
+}
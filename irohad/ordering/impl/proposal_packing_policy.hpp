@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICY_HPP
+#define IROHA_PROPOSAL_PACKING_POLICY_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Policy which selects batches for a proposal of the ordering service
+     */
+    class ProposalPackingPolicy {
+     public:
+      using BatchType =
+          std::shared_ptr<shared_model::interface::TransactionBatch>;
+
+      /**
+       * Batch waiting for a proposal
+       */
+      struct Candidate {
+        BatchType batch;
+        /// number of proposals the batch did not get into
+        size_t age;
+      };
+
+      /**
+       * Result of packing
+       */
+      struct Packing {
+        /// batches of the proposal in their order in the proposal
+        std::vector<BatchType> packed;
+        /// batches which did not get into the proposal, most preferred first
+        std::vector<Candidate> rest;
+      };
+
+      /**
+       * Select batches for a proposal
+       * @param candidates - batches in order of their arrival
+       * @param transaction_limit - maximal number of transactions in the
+       * proposal
+       * @return selected batches and the rest of candidates
+       */
+      virtual Packing pack(std::vector<Candidate> candidates,
+                           size_t transaction_limit) const = 0;
+
+      virtual ~ProposalPackingPolicy() = default;
+    };
+
+    /**
+     * Packs batches in order of their arrival, batches which do not fit are
+     * skipped
+     */
+    class FifoPackingPolicy : public ProposalPackingPolicy {
+     public:
+      Packing pack(std::vector<Candidate> candidates,
+                   size_t transaction_limit) const override;
+    };
+
+    /**
+     * Packs batches with greater priority first, batches of the same priority
+     * are ordered by age, then by size, so that older and smaller batches go
+     * first. Number of transactions of a single creator in a proposal may be
+     * limited, so that a few busy accounts do not take the whole proposal
+     */
+    class PriorityPackingPolicy : public ProposalPackingPolicy {
+     public:
+      /// priority of a batch, batches with greater values are packed first
+      using PriorityFunction = std::function<int(
+          const shared_model::interface::TransactionBatch &)>;
+
+      /**
+       * @param priority - priority of batches
+       * @param creator_quota - maximal number of transactions of one creator
+       * in a proposal, 0 means no limit
+       */
+      PriorityPackingPolicy(PriorityFunction priority, size_t creator_quota);
+
+      /**
+       * Create priority function by creators of transactions
+       * @param priorities - priorities of creator accounts, other accounts
+       * have zero priority
+       * @return function which gives a batch the greatest priority of its
+       * creators
+       */
+      static PriorityFunction creatorPriority(
+          std::unordered_map<std::string, int> priorities);
+
+      Packing pack(std::vector<Candidate> candidates,
+                   size_t transaction_limit) const override;
+
+     private:
+      PriorityFunction priority_;
+      size_t creator_quota_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICY_HPP
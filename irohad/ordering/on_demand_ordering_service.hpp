@@ -8,6 +8,12 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+namespace shared_model {
+  namespace crypto {
+    class Blob;
+  }  // namespace crypto
+}  // namespace shared_model
+
 namespace iroha {
   namespace ordering {
 
@@ -16,11 +22,26 @@ namespace iroha {
      */
     class OnDemandOrderingService : public transport::OdOsNotification {
      public:
+      /**
+       * Type of serialized proposals, shared by all requests of a round
+       */
+      using ProposalBlobType =
+          std::shared_ptr<const shared_model::crypto::Blob>;
+
       /**
        * Method which should be invoked on outcome of collaboration for round
        * @param round - proposal round which has started
        */
       virtual void onCollaborationOutcome(consensus::Round round) = 0;
+
+      /**
+       * Callback on request about serialized proposal. Unlike
+       * onRequestProposal, the proposal is not copied
+       * @param round - number of collaboration round
+       * @return serialized proposal for requested round
+       */
+      virtual boost::optional<ProposalBlobType> onRequestProposalBlob(
+          consensus::Round round) = 0;
     };
 
   }  // namespace ordering
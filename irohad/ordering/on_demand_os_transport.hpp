@@ -6,6 +6,7 @@
 #ifndef IROHA_ON_DEMAND_OS_TRANSPORT_HPP
 #define IROHA_ON_DEMAND_OS_TRANSPORT_HPP
 
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -63,6 +64,24 @@ namespace iroha {
         virtual boost::optional<ProposalType> onRequestProposal(
             consensus::Round round) = 0;
 
+        /**
+         * Callback which receives requested proposal
+         */
+        using ProposalCallbackType =
+            std::function<void(boost::optional<ProposalType>)>;
+
+        /**
+         * Request proposal without waiting for the response. Default
+         * implementation calls onRequestProposal
+         * @param round - number of collaboration round
+         * @param callback - called once with the proposal for requested round,
+         * possibly on another thread
+         */
+        virtual void requestProposal(consensus::Round round,
+                                     ProposalCallbackType callback) {
+          callback(onRequestProposal(round));
+        }
+
         virtual ~OdOsNotification() = default;
       };
 
@@ -34,6 +34,7 @@ namespace torii {
           transaction_batch_factory,
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
       int maximum_rounds_without_update,
+      std::shared_ptr<StatelessValidationPool> validation_pool,
       logger::Logger log)
       : command_service_(std::move(command_service)),
         status_bus_(std::move(status_bus)),
@@ -41,6 +42,7 @@ namespace torii {
         transaction_factory_(std::move(transaction_factory)),
         batch_parser_(std::move(batch_parser)),
         batch_factory_(std::move(transaction_batch_factory)),
+        validation_pool_(std::move(validation_pool)),
         log_(std::move(log)),
         consensus_gate_objects_(std::move(consensus_gate_objects)),
         maximum_rounds_without_update_(maximum_rounds_without_update) {}
@@ -92,8 +94,8 @@ namespace torii {
   CommandServiceTransportGrpc::deserializeTransactions(
       const iroha::protocol::TxList *request) {
     shared_model::interface::types::SharedTxsCollectionType tx_collection;
-    for (const auto &tx : request->transactions()) {
-      transaction_factory_->build(tx).match(
+    auto handle_result = [this, &tx_collection](auto &result) {
+      result.match(
           [&tx_collection](
               iroha::expected::Value<
                   std::unique_ptr<shared_model::interface::Transaction>> &v) {
@@ -105,6 +107,18 @@ namespace torii {
                 shared_model::interface::TxStatusFactory::TransactionError{
                     error.error.error, 0, 0}));
           });
+    };
+
+    // a single transaction is not worth a hand-off to the pool
+    if (validation_pool_ and request->transactions_size() > 1) {
+      for (auto &result : validation_pool_->build(request->transactions())) {
+        handle_result(result);
+      }
+    } else {
+      for (const auto &tx : request->transactions()) {
+        auto result = transaction_factory_->build(tx);
+        handle_result(result);
+      }
     }
     return tx_collection;
   }
@@ -13,6 +13,7 @@
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger.hpp"
+#include "torii/impl/stateless_validation_pool.hpp"
 
 namespace iroha {
   namespace torii {
@@ -50,6 +51,8 @@ namespace torii {
      * @param consensus_gate_objects - events from consensus gate
      * @param maximum_rounds_without_update - defines how long tx status
      * stream is kept alive when no new tx statuses appear
+     * @param validation_pool - if present, transactions of lists are
+     * validated with it concurrently
      * @param log to print progress
      */
     CommandServiceTransportGrpc(
@@ -64,6 +67,7 @@ namespace torii {
             transaction_batch_factory,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
+        std::shared_ptr<StatelessValidationPool> validation_pool = nullptr,
         logger::Logger log = logger::log("CommandServiceTransportGrpc"));
 
     /**
@@ -130,6 +134,7 @@ namespace torii {
         batch_parser_;
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
         batch_factory_;
+    std::shared_ptr<StatelessValidationPool> validation_pool_;
     logger::Logger log_;
 
     rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/stateless_validation_pool.hpp"
+
+namespace torii {
+
+  constexpr size_t StatelessValidationPool::kDefaultQueueCapacity;
+
+  StatelessValidationPool::StatelessValidationPool(
+      std::shared_ptr<TransportFactoryType> transaction_factory,
+      size_t workers,
+      size_t queue_capacity)
+      : transaction_factory_(std::move(transaction_factory)),
+        queue_capacity_(queue_capacity),
+        stop_(false) {
+    for (size_t i = 0; i < workers; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+
+  StatelessValidationPool::~StatelessValidationPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::vector<StatelessValidationPool::BuildResult>
+  StatelessValidationPool::build(
+      const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+          &transactions) {
+    std::vector<std::future<BuildResult>> futures;
+    futures.reserve(transactions.size());
+    for (const auto &transaction : transactions) {
+      Task task([this, &transaction] {
+        return transaction_factory_->build(transaction);
+      });
+      futures.push_back(task.get_future());
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (not workers_.empty() and tasks_.size() < queue_capacity_) {
+        tasks_.push_back(std::move(task));
+        lock.unlock();
+        condition_.notify_one();
+      } else {
+        lock.unlock();
+        task();
+      }
+    }
+
+    std::vector<BuildResult> results;
+    results.reserve(futures.size());
+    for (auto &future : futures) {
+      results.push_back(future.get());
+    }
+    return results;
+  }
+
+  void StatelessValidationPool::work() {
+    while (true) {
+      Task task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return stop_ or not tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+}  // namespace torii
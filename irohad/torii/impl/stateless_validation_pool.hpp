@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_STATELESS_VALIDATION_POOL_HPP
+#define TORII_STATELESS_VALIDATION_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "endpoint.pb.h"
+#include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace torii {
+
+  /**
+   * Parses and statelessly validates transport transactions on a fixed set
+   * of worker threads. The queue of pending transactions is bounded: when it
+   * is full, the submitting thread validates the transaction itself, which
+   * slows down clients sending more than the workers can handle
+   */
+  class StatelessValidationPool {
+   public:
+    using TransportFactoryType =
+        shared_model::interface::AbstractTransportFactory<
+            shared_model::interface::Transaction,
+            iroha::protocol::Transaction>;
+    using BuildResult = iroha::expected::Result<
+        std::unique_ptr<shared_model::interface::Transaction>,
+        TransportFactoryType::Error>;
+
+    static constexpr size_t kDefaultQueueCapacity = 1024;
+
+    /**
+     * @param transaction_factory - factory which parses and validates
+     * transactions, must be safe to call from several threads
+     * @param workers - number of validating threads
+     * @param queue_capacity - maximal number of transactions waiting for
+     * validation
+     */
+    StatelessValidationPool(
+        std::shared_ptr<TransportFactoryType> transaction_factory,
+        size_t workers,
+        size_t queue_capacity = kDefaultQueueCapacity);
+
+    StatelessValidationPool(const StatelessValidationPool &) = delete;
+    StatelessValidationPool &operator=(const StatelessValidationPool &) =
+        delete;
+
+    ~StatelessValidationPool();
+
+    /**
+     * Build all transactions of the list concurrently
+     * @param transactions - transport transactions, must outlive the call
+     * @return results in the order of the list
+     */
+    std::vector<BuildResult> build(
+        const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+            &transactions);
+
+   private:
+    using Task = std::packaged_task<BuildResult()>;
+
+    void work();
+
+    std::shared_ptr<TransportFactoryType> transaction_factory_;
+    const size_t queue_capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<Task> tasks_;
+    bool stop_;
+    std::vector<std::thread> workers_;
+  };
+
+}  // namespace torii
+
+#endif  // TORII_STATELESS_VALIDATION_POOL_HPP
@@ -11,14 +11,19 @@
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 
 namespace iroha {
   namespace validation {
     ChainValidatorImpl::ChainValidatorImpl(
         std::shared_ptr<consensus::yac::SupermajorityChecker>
             supermajority_checker,
+        std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+            verifier_pool,
         logger::Logger log)
-        : supermajority_checker_(supermajority_checker), log_(std::move(log)) {}
+        : supermajority_checker_(supermajority_checker),
+          verifier_pool_(std::move(verifier_pool)),
+          log_(std::move(log)) {}
 
     bool ChainValidatorImpl::validateAndApply(
         rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -79,6 +84,31 @@ namespace iroha {
       return has_supermajority;
     }
 
+    bool ChainValidatorImpl::validateSignatures(
+        const shared_model::interface::Block &block) const {
+      std::vector<shared_model::crypto::VerificationEntry> entries;
+      auto add_entries = [&entries](const auto &signable) {
+        for (const auto &signature : signable.signatures()) {
+          entries.push_back({signature.signedData(),
+                             signable.payload(),
+                             signature.publicKey()});
+        }
+      };
+      add_entries(block);
+      for (const auto &transaction : block.transactions()) {
+        add_entries(transaction);
+      }
+
+      auto invalid = verifier_pool_->verify(entries);
+      if (not invalid.empty()) {
+        log_->info("Block contains {} wrong signatures, first is [{};{}]",
+                   invalid.size(),
+                   entries[invalid.front()].signed_data.hex(),
+                   entries[invalid.front()].public_key.hex());
+      }
+      return invalid.empty();
+    }
+
     bool ChainValidatorImpl::validateBlock(
         const shared_model::interface::Block &block,
         ametsuchi::PeerQuery &queries,
@@ -94,7 +124,8 @@ namespace iroha {
       }
 
       return validatePreviousHash(block, top_hash)
-          and validatePeerSupermajority(block, *peers);
+          and validatePeerSupermajority(block, *peers)
+          and (not verifier_pool_ or validateSignatures(block));
     }
 
   }  // namespace validation
@@ -10,6 +10,7 @@
 
 #include <memory>
 
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 
@@ -34,9 +35,17 @@ namespace iroha {
   namespace validation {
     class ChainValidatorImpl : public ChainValidator {
      public:
+      /**
+       * @param supermajority_checker - checker of block signatories
+       * @param verifier_pool - if present, signatures of blocks and their
+       * transactions are verified with it before blocks are applied
+       * @param log - logger
+       */
       explicit ChainValidatorImpl(
           std::shared_ptr<consensus::yac::SupermajorityChecker>
               supermajority_checker,
+          std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+              verifier_pool = nullptr,
           logger::Logger log = logger::log("ChainValidator"));
 
       bool validateAndApply(
@@ -56,6 +65,10 @@ namespace iroha {
           const std::vector<std::shared_ptr<shared_model::interface::Peer>>
               &peers) const;
 
+      /// Verifies signatures of the block and all of its transactions at once
+      bool validateSignatures(
+          const shared_model::interface::Block &block) const;
+
       /**
        * Verifies previous hash and whether the block is signed by supermajority
        * of ledger peers
@@ -71,6 +84,9 @@ namespace iroha {
       std::shared_ptr<consensus::yac::SupermajorityChecker>
           supermajority_checker_;
 
+      std::shared_ptr<shared_model::crypto::CryptoVerifierPool<>>
+          verifier_pool_;
+
       logger::Logger log_;
     };
   }  // namespace validation
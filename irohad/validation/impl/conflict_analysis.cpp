@@ -0,0 +1,215 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/conflict_analysis.hpp"
+
+#include <map>
+#include <numeric>
+
+#include "common/visitor.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  std::string accountKey(const std::string &account_id) {
+    return "account:" + account_id;
+  }
+
+  std::string assetKey(const std::string &asset_id) {
+    return "asset:" + asset_id;
+  }
+
+  std::string domainKey(const std::string &domain_id) {
+    return "domain:" + domain_id;
+  }
+
+  std::string roleKey(const std::string &role_id) {
+    return "role:" + role_id;
+  }
+
+  /// signatories are stored in a table shared by all accounts, concurrent
+  /// inserts of the same key would wait for each other
+  std::string signatoryKey(const shared_model::crypto::PublicKey &pubkey) {
+    return "signatory:" + pubkey.hex();
+  }
+
+  const std::string kPeersKey = "peers";
+
+  /**
+   * Union-find over unit indices
+   */
+  class DisjointSets {
+   public:
+    explicit DisjointSets(size_t size) : parent_(size) {
+      std::iota(parent_.begin(), parent_.end(), 0);
+    }
+
+    size_t find(size_t i) {
+      while (parent_[i] != i) {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+      }
+      return i;
+    }
+
+    /// the smaller root is kept, so the root of a set is its first unit
+    void unite(size_t a, size_t b) {
+      a = find(a);
+      b = find(b);
+      if (a < b) {
+        parent_[b] = a;
+      } else if (b < a) {
+        parent_[a] = b;
+      }
+    }
+
+   private:
+    std::vector<size_t> parent_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    void ReadWriteSet::merge(const ReadWriteSet &other) {
+      reads.insert(other.reads.begin(), other.reads.end());
+      writes.insert(other.writes.begin(), other.writes.end());
+    }
+
+    ReadWriteSet readWriteSet(
+        const shared_model::interface::Transaction &transaction) {
+      ReadWriteSet set;
+      const auto &creator = transaction.creatorAccountId();
+      // signatories, quorum and permissions of the creator are checked
+      set.reads.insert(accountKey(creator));
+
+      for (const auto &command : transaction.commands()) {
+        visit_in_place(
+            command.get(),
+            [&](const shared_model::interface::AddAssetQuantity &c) {
+              set.reads.insert(assetKey(c.assetId()));
+              set.writes.insert(accountKey(creator));
+            },
+            [&](const shared_model::interface::AddPeer &) {
+              set.writes.insert(kPeersKey);
+            },
+            [&](const shared_model::interface::AddSignatory &c) {
+              set.writes.insert(accountKey(c.accountId()));
+              set.writes.insert(signatoryKey(c.pubkey()));
+            },
+            [&](const shared_model::interface::AppendRole &c) {
+              set.reads.insert(roleKey(c.roleName()));
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::CreateAccount &c) {
+              set.reads.insert(domainKey(c.domainId()));
+              set.writes.insert(
+                  accountKey(c.accountName() + "@" + c.domainId()));
+              set.writes.insert(signatoryKey(c.pubkey()));
+            },
+            [&](const shared_model::interface::CreateAsset &c) {
+              set.reads.insert(domainKey(c.domainId()));
+              set.writes.insert(assetKey(c.assetName() + "#" + c.domainId()));
+            },
+            [&](const shared_model::interface::CreateDomain &c) {
+              set.reads.insert(roleKey(c.userDefaultRole()));
+              set.writes.insert(domainKey(c.domainId()));
+            },
+            [&](const shared_model::interface::CreateRole &c) {
+              set.writes.insert(roleKey(c.roleName()));
+            },
+            [&](const shared_model::interface::DetachRole &c) {
+              set.reads.insert(roleKey(c.roleName()));
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::GrantPermission &c) {
+              set.writes.insert(accountKey(creator));
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::RemoveSignatory &c) {
+              set.writes.insert(accountKey(c.accountId()));
+              set.writes.insert(signatoryKey(c.pubkey()));
+            },
+            [&](const shared_model::interface::RevokePermission &c) {
+              set.writes.insert(accountKey(creator));
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::SetAccountDetail &c) {
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::SetQuorum &c) {
+              set.writes.insert(accountKey(c.accountId()));
+            },
+            [&](const shared_model::interface::SubtractAssetQuantity &c) {
+              set.reads.insert(assetKey(c.assetId()));
+              set.writes.insert(accountKey(creator));
+            },
+            [&](const shared_model::interface::TransferAsset &c) {
+              set.reads.insert(assetKey(c.assetId()));
+              set.writes.insert(accountKey(c.srcAccountId()));
+              set.writes.insert(accountKey(c.destAccountId()));
+            });
+      }
+      return set;
+    }
+
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<ReadWriteSet> &units) {
+      // units touching a key, and whether any of them writes it
+      std::map<std::string, std::pair<std::vector<size_t>, bool>> keys;
+      for (size_t i = 0; i < units.size(); ++i) {
+        for (const auto &key : units[i].reads) {
+          keys[key].first.push_back(i);
+        }
+        for (const auto &key : units[i].writes) {
+          auto &entry = keys[key];
+          entry.first.push_back(i);
+          entry.second = true;
+        }
+      }
+
+      DisjointSets sets(units.size());
+      for (const auto &key : keys) {
+        const auto &touching = key.second.first;
+        if (key.second.second) {
+          for (auto i : touching) {
+            sets.unite(touching.front(), i);
+          }
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      std::vector<size_t> group_of_root(units.size());
+      for (size_t i = 0; i < units.size(); ++i) {
+        auto root = sets.find(i);
+        if (root == i) {
+          group_of_root[i] = groups.size();
+          groups.emplace_back();
+        }
+        groups[group_of_root[root]].push_back(i);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
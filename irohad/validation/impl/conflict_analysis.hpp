@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CONFLICT_ANALYSIS_HPP
+#define IROHA_CONFLICT_ANALYSIS_HPP
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Parts of the world state read and written by transactions. Keys are
+     * coarse: an account key covers its signatories, quorum, roles, grantable
+     * permissions, details and balances
+     */
+    struct ReadWriteSet {
+      std::unordered_set<std::string> reads;
+      std::unordered_set<std::string> writes;
+
+      /**
+       * Add keys of the other set to this one
+       */
+      void merge(const ReadWriteSet &other);
+    };
+
+    /**
+     * Derive the state touched by stateful validation of the transaction from
+     * its creator and commands
+     * @param transaction - transaction to analyze
+     * @return keys read and written by the transaction
+     */
+    ReadWriteSet readWriteSet(
+        const shared_model::interface::Transaction &transaction);
+
+    /**
+     * Split units of validation into groups, so that no unit of a group
+     * writes the state read or written by a unit of another group. Groups
+     * can be validated concurrently, each in proposal order
+     * @param units - read and write sets of units in proposal order
+     * @return groups of unit indices, indices are ascending in each group and
+     * groups are ordered by their first unit
+     */
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<ReadWriteSet> &units);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_CONFLICT_ANALYSIS_HPP
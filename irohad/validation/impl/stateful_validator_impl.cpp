@@ -5,6 +5,8 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <algorithm>
+#include <future>
 #include <string>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
@@ -14,6 +16,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
+#include "validation/impl/conflict_analysis.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
@@ -41,87 +44,205 @@ namespace iroha {
     };
 
     /**
-     * Validate all transactions supplied; includes special rules, such as batch
-     * validation etc
-     * @param txs to be validated
+     * Validate transactions of a batch; includes special rules for atomic
+     * batches
+     * @param batch to be validated
      * @param temporary_wsv to apply transactions on
      * @param transactions_errors_log to write errors to
-     * @param log to write errors to console
-     * @param batch_parser to parse batches from transaction range
-     * @return range of transactions, which passed stateful validation
+     * @return validation result of each transaction of the batch
      */
-    static auto validateTransactions(
-        const shared_model::interface::types::TransactionsCollectionType &txs,
+    static std::vector<bool> validateBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
         ametsuchi::TemporaryWsv &temporary_wsv,
-        validation::TransactionsErrors &transactions_errors_log,
-        const logger::Logger &log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
-      std::vector<bool> validation_results;
-      validation_results.reserve(boost::size(txs));
-
-      for (auto batch : batch_parser.parseBatches(txs)) {
-        auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
-        };
-        if (batch.front().batchMeta()
-            and batch.front().batchMeta()->get()->type()
-                == shared_model::interface::types::BatchType::ATOMIC) {
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + batch.front().hash().hex());
-          bool validation_result = false;
-
-          if (boost::algorithm::all_of(batch, validation)) {
-            // batch is successful; release savepoint
-            validation_result = true;
-            savepoint->release();
-          } else {
-            auto failed_tx_hash = transactions_errors_log.back().tx_hash;
-            for (const auto &tx : batch) {
-              if (tx.hash() != failed_tx_hash) {
-                transactions_errors_log.emplace_back(
-                    validation::TransactionError{
-                        tx.hash(),
-                        // TODO igor-egorov 22.01.2019 IR-245 add a separate
-                        // error code for failed batch case
-                        validation::CommandError{
-                            "",
-                            1,  // internal error code
-                            "Another transaction failed the batch",
-                            true,
-                            std::numeric_limits<size_t>::max()}});
-              }
-            }
-          }
+        validation::TransactionsErrors &transactions_errors_log) {
+      auto validation = [&](auto &tx) {
+        return checkTransactions(temporary_wsv, transactions_errors_log, tx);
+      };
+      if (batch.front().batchMeta()
+          and batch.front().batchMeta()->get()->type()
+              == shared_model::interface::types::BatchType::ATOMIC) {
+        // check all batch's transactions for validness
+        auto savepoint = temporary_wsv.createSavepoint(
+            "batch_" + batch.front().hash().hex());
+        bool validation_result = false;
 
-          validation_results.insert(
-              validation_results.end(), boost::size(batch), validation_result);
+        if (boost::algorithm::all_of(batch, validation)) {
+          // batch is successful; release savepoint
+          validation_result = true;
+          savepoint->release();
         } else {
+          auto failed_tx_hash = transactions_errors_log.back().tx_hash;
           for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
+            if (tx.hash() != failed_tx_hash) {
+              transactions_errors_log.emplace_back(validation::TransactionError{
+                  tx.hash(),
+                  // TODO igor-egorov 22.01.2019 IR-245 add a separate
+                  // error code for failed batch case
+                  validation::CommandError{
+                      "",
+                      1,  // internal error code
+                      "Another transaction failed the batch",
+                      true,
+                      std::numeric_limits<size_t>::max()}});
+            }
           }
         }
+
+        return std::vector<bool>(boost::size(batch), validation_result);
       }
+      std::vector<bool> validation_results;
+      for (const auto &tx : batch) {
+        validation_results.push_back(validation(tx));
+      }
+      return validation_results;
+    }
 
-      return txs | boost::adaptors::indexed()
-          | boost::adaptors::filtered(
-                 [validation_results =
-                      std::move(validation_results)](const auto &el) {
-                   return validation_results.at(el.index());
-                 })
-          | boost::adaptors::transformed(
-                 [](const auto &el) -> decltype(auto) { return el.value(); });
+    /**
+     * Validate all batches one after another
+     * @param batches to be validated
+     * @param temporary_wsv to apply transactions on
+     * @param transactions_errors_log to write errors to
+     * @return validation result of each transaction
+     */
+    static std::vector<bool> validateSequentially(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        validation::TransactionsErrors &transactions_errors_log) {
+      std::vector<bool> validation_results;
+      for (const auto &batch : batches) {
+        auto batch_results =
+            validateBatch(batch, temporary_wsv, transactions_errors_log);
+        validation_results.insert(validation_results.end(),
+                                  batch_results.begin(),
+                                  batch_results.end());
+      }
+      return validation_results;
     }
 
     StatefulValidatorImpl::StatefulValidatorImpl(
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
+        std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory,
+        size_t concurrency,
         logger::Logger log)
         : factory_(std::move(factory)),
           batch_parser_(std::move(batch_parser)),
+          temporary_factory_(std::move(temporary_factory)),
+          concurrency_(concurrency),
           log_(std::move(log)) {}
 
+    boost::optional<std::vector<bool>>
+    StatefulValidatorImpl::validateConcurrently(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        validation::TransactionsErrors &transactions_errors_log) {
+      std::vector<ReadWriteSet> sets;
+      for (const auto &batch : batches) {
+        ReadWriteSet set;
+        for (const auto &tx : batch) {
+          set.merge(readWriteSet(tx));
+        }
+        sets.push_back(std::move(set));
+      }
+      auto groups = independentGroups(sets);
+      if (groups.size() < 2) {
+        return boost::none;
+      }
+
+      // largest groups are assigned first, each to the least loaded worker
+      auto workers = std::min(concurrency_, groups.size());
+      std::stable_sort(
+          groups.begin(), groups.end(), [](const auto &a, const auto &b) {
+            return a.size() > b.size();
+          });
+      std::vector<std::vector<size_t>> assigned(workers);
+      for (const auto &group : groups) {
+        auto &worker = *std::min_element(
+            assigned.begin(), assigned.end(), [](const auto &a, const auto &b) {
+              return a.size() < b.size();
+            });
+        worker.insert(worker.end(), group.begin(), group.end());
+      }
+
+      struct BatchResult {
+        std::vector<bool> validation_results;
+        validation::TransactionsErrors errors;
+      };
+      std::vector<BatchResult> results(batches.size());
+      std::vector<std::future<bool>> futures;
+      for (auto &units : assigned) {
+        // groups are independent, so their units can be interleaved as long
+        // as each group keeps the proposal order
+        std::sort(units.begin(), units.end());
+        futures.push_back(std::async(std::launch::async, [&, &units = units] {
+          return temporary_factory_->createTemporaryWsv().match(
+              [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                      &wsv) {
+                for (auto unit : units) {
+                  results[unit].validation_results = validateBatch(
+                      batches[unit], *wsv.value, results[unit].errors);
+                }
+                return true;
+              },
+              [&](const expected::Error<std::string> &error) {
+                log_->warn("failed to create temporary wsv: {}", error.error);
+                return false;
+              });
+        }));
+      }
+      bool validated = true;
+      for (auto &future : futures) {
+        validated = future.get() and validated;
+      }
+      if (not validated) {
+        return boost::none;
+      }
+
+      // changes of workers are discarded, valid transactions are applied to
+      // the given state in proposal order
+      std::vector<bool> validation_results;
+      std::vector<
+          std::reference_wrapper<const shared_model::interface::Transaction>>
+          valid_txs;
+      validation::TransactionsErrors errors;
+      for (size_t i = 0; i < batches.size(); ++i) {
+        auto result = results[i].validation_results.begin();
+        for (const auto &tx : batches[i]) {
+          if (*result) {
+            valid_txs.emplace_back(tx);
+          }
+          validation_results.push_back(*result++);
+        }
+        std::move(results[i].errors.begin(),
+                  results[i].errors.end(),
+                  std::back_inserter(errors));
+      }
+
+      return temporary_wsv.applyValidated(valid_txs).match(
+          [&](const expected::Value<void> &)
+              -> boost::optional<std::vector<bool>> {
+            log_->info("validated {} independent groups on {} workers",
+                       groups.size(),
+                       workers);
+            std::move(errors.begin(),
+                      errors.end(),
+                      std::back_inserter(transactions_errors_log));
+            return validation_results;
+          },
+          [this](const expected::Error<std::string> &error)
+              -> boost::optional<std::vector<bool>> {
+            log_->warn("failed to apply validated transactions: {}",
+                       error.error);
+            return boost::none;
+          });
+    }
+
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
         const shared_model::interface::Proposal &proposal,
@@ -130,12 +251,27 @@ namespace iroha {
                  proposal.transactions().size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
-      auto valid_txs =
-          validateTransactions(proposal.transactions(),
-                               temporaryWsv,
-                               validation_result->rejected_transactions,
-                               log_,
-                               *batch_parser_);
+      auto batches = batch_parser_->parseBatches(proposal.transactions());
+
+      boost::optional<std::vector<bool>> validation_results;
+      if (temporary_factory_ and concurrency_ > 1) {
+        validation_results = validateConcurrently(
+            batches, temporaryWsv, validation_result->rejected_transactions);
+      }
+      if (not validation_results) {
+        validation_results = validateSequentially(
+            batches, temporaryWsv, validation_result->rejected_transactions);
+      }
+
+      auto valid_txs = proposal.transactions() | boost::adaptors::indexed()
+          | boost::adaptors::filtered(
+                           [&validation_results](const auto &el) {
+                             return validation_results->at(el.index());
+                           })
+          | boost::adaptors::transformed(
+                           [](const auto &el) -> decltype(auto) {
+                             return el.value();
+                           });
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions has been validated as well
@@ -8,6 +8,7 @@
 
 #include "validation/stateful_validator.hpp"
 
+#include "ametsuchi/temporary_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
@@ -17,6 +18,11 @@ namespace iroha {
 
     /**
      * Interface for performing stateful validation
+     *
+     * If a temporary factory and concurrency greater than one are given,
+     * groups of batches which do not touch the same state are validated
+     * concurrently in separate temporary wsvs, and the valid transactions are
+     * then applied to the given temporary wsv in proposal order
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
@@ -25,6 +31,9 @@ namespace iroha {
               factory,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
+          std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory =
+              nullptr,
+          size_t concurrency = 1,
           logger::Logger log = logger::log("SFV"));
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
@@ -32,9 +41,25 @@ namespace iroha {
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
+      /**
+       * Validate independent groups of batches concurrently and apply valid
+       * transactions to the temporary wsv
+       * @return validation result of each transaction, none if the proposal
+       * can not be split or concurrent validation failed, nothing is applied
+       * to the temporary wsv and written to the log in this case
+       */
+      boost::optional<std::vector<bool>> validateConcurrently(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches,
+          ametsuchi::TemporaryWsv &temporary_wsv,
+          validation::TransactionsErrors &transactions_errors_log);
+
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
+      std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory_;
+      size_t concurrency_;
       logger::Logger log_;
     };
 
@@ -62,6 +62,34 @@ namespace iroha {
     return hexstringToBytestring(string) | stringToBlob<size>;
   }
 
+  /**
+   * Write unsigned integer to the buffer in little-endian byte order
+   * @tparam T - unsigned integer type
+   * @param out - buffer of at least sizeof(T) bytes
+   * @param value - integer to write
+   */
+  template <typename T>
+  inline void writeLittleEndian(uint8_t *out, T value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  /**
+   * Read unsigned integer stored in little-endian byte order
+   * @tparam T - unsigned integer type
+   * @param in - buffer of at least sizeof(T) bytes
+   * @return read integer
+   */
+  template <typename T>
+  inline T readLittleEndian(const uint8_t *in) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      value |= static_cast<T>(in[i]) << (8 * i);
+    }
+    return value;
+  }
+
 }  // namespace iroha
 
 #endif  // IROHA_BYTEUTILS_H
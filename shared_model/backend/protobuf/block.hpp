@@ -8,6 +8,7 @@
 
 #include "interfaces/iroha_internal/block.hpp"
 
+#include <google/protobuf/arena.h>
 #include "block.pb.h"
 #include "interfaces/common_objects/types.hpp"
 
@@ -22,6 +23,14 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create block from the transport object allocated in the arena, which
+       * is owned by the block and frees the transport object at once
+       * @param arena - arena of the transport object
+       * @param ref - transport object allocated in the arena
+       */
+      Block(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
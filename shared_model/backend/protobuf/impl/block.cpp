@@ -15,18 +15,32 @@ namespace shared_model {
   namespace proto {
 
     struct Block::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(TransportType &&ref)
+          : moved_proto_{std::make_unique<TransportType>(std::move(ref))},
+            proto_{*moved_proto_} {}
+      explicit Impl(const TransportType &ref)
+          : arena_{std::make_unique<google::protobuf::Arena>()},
+            proto_{copyToArena(ref, *arena_)} {}
+      Impl(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_{std::move(arena)}, proto_{ref} {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
+      /// owner of the transport object, either the arena or the moved object
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      std::unique_ptr<TransportType> moved_proto_;
+
+      TransportType &proto_;
       iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
 
+      /// transactions refer to the messages of the block
       std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
+        std::vector<proto::Transaction> transactions;
+        transactions.reserve(payload_.transactions_size());
+        for (auto &transaction : *payload_.mutable_transactions()) {
+          transactions.emplace_back(std::ref(transaction));
+        }
+        return transactions;
       }()};
 
       interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
@@ -70,6 +84,11 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::unique_ptr<google::protobuf::Arena> arena,
+                 TransportType &ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(arena), ref);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -13,16 +13,31 @@ namespace shared_model {
     using namespace interface::types;
 
     struct Proposal::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
+      explicit Impl(TransportType &&ref)
+          : moved_proto_{std::make_unique<TransportType>(std::move(ref))},
+            proto_{*moved_proto_} {}
 
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(const TransportType &ref)
+          : arena_{std::make_unique<google::protobuf::Arena>()},
+            proto_{copyToArena(ref, *arena_)} {}
 
-      TransportType proto_;
+      Impl(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_{std::move(arena)}, proto_{ref} {}
 
+      /// owner of the transport object, either the arena or the moved object
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      std::unique_ptr<TransportType> moved_proto_;
+
+      TransportType &proto_;
+
+      /// transactions refer to the messages of the proposal
       const std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
+        std::vector<proto::Transaction> transactions;
+        transactions.reserve(proto_.transactions_size());
+        for (auto &transaction : *proto_.mutable_transactions()) {
+          transactions.emplace_back(std::ref(transaction));
+        }
+        return transactions;
       }()};
 
       interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
@@ -41,6 +56,11 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(std::unique_ptr<google::protobuf::Arena> arena,
+                       TransportType &ref) {
+      impl_ = std::make_unique<Proposal::Impl>(std::move(arena), ref);
+    }
+
     TransactionsCollectionType Proposal::transactions() const {
       return impl_->transactions_;
     }
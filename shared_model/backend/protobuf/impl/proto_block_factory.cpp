@@ -26,7 +26,10 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
+  // the block and copies of the transactions are allocated in the arena
+  auto arena = std::make_unique<google::protobuf::Arena>();
+  auto &block = *google::protobuf::Arena::CreateMessage<
+      iroha::protocol::Block_v1>(arena.get());
   auto *block_payload = block.mutable_payload();
   block_payload->set_height(height);
   block_payload->set_prev_block_hash(prev_hash.hex());
@@ -48,7 +51,8 @@ ProtoBlockFactory::unsafeCreateBlock(
                   (*next_hash) = hash.hex();
                 });
 
-  return std::make_unique<shared_model::proto::Block>(std::move(block));
+  return std::make_unique<shared_model::proto::Block>(std::move(arena),
+                                                      block);
 }
 
 iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
@@ -59,7 +63,7 @@ ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
   }
 
   std::unique_ptr<shared_model::interface::Block> proto_block =
-      std::make_unique<Block>(std::move(block.block_v1()));
+      std::make_unique<Block>(std::move(*block.mutable_block_v1()));
   if (auto errors = interface_validator_->validate(*proto_block)) {
     return iroha::expected::makeError(errors.reason());
   }
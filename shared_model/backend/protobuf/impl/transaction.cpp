@@ -5,6 +5,8 @@
 
 #include "backend/protobuf/transaction.hpp"
 
+#include <mutex>
+
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/batch_meta.hpp"
 #include "backend/protobuf/commands/proto_command.hpp"
@@ -20,6 +22,8 @@ namespace shared_model {
 
       explicit Impl(const TransportType &ref) : proto_{ref} {}
 
+      explicit Impl(TransportType &ref) : proto_{ref} {}
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -28,20 +32,83 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      /// serialized transaction, depends on signatures. The reference stays
+      /// valid until the transaction is destroyed, even if a signature is
+      /// added meanwhile
+      const interface::types::BlobType &blob() {
+        std::lock_guard<std::mutex> lock(blob_mutex_);
+        if (not blob_) {
+          blob_ = std::make_unique<const interface::types::BlobType>(
+              makeBlob(*proto_));
+        }
+        return *blob_;
+      }
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      const interface::types::BlobType &payloadBlob() {
+        std::call_once(payload_blob_once_,
+                       [this] { payload_blob_ = makeBlob(payload_); });
+        return *payload_blob_;
+      }
 
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
+      const interface::types::BlobType &reducedPayloadBlob() {
+        std::call_once(reduced_payload_blob_once_, [this] {
+          reduced_payload_blob_ = makeBlob(reduced_payload_);
+        });
+        return *reduced_payload_blob_;
+      }
 
-      interface::types::HashType reduced_hash_{
-          shared_model::crypto::Sha3_256::makeHash(reduced_payload_blob_)};
+      const interface::types::HashType &reducedHash() {
+        std::call_once(reduced_hash_once_, [this] {
+          reduced_hash_ =
+              shared_model::crypto::Sha3_256::makeHash(reducedPayloadBlob());
+        });
+        return *reduced_hash_;
+      }
+
+      const std::vector<proto::Command> &commands() {
+        std::call_once(commands_once_, [this] {
+          commands_.emplace(reduced_payload_.mutable_commands()->begin(),
+                            reduced_payload_.mutable_commands()->end());
+        });
+        return *commands_;
+      }
 
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
+      /**
+       * Add the signature to the transport and retire the values which
+       * depend on signatures. Retired blob is kept alive, because a reader
+       * may still hold a reference to it
+       */
+      void addSignature(const crypto::Signed &signed_blob,
+                        const crypto::PublicKey &public_key) {
+        std::lock_guard<std::mutex> lock(blob_mutex_);
+        auto sig = proto_->add_signatures();
+        sig->set_signature(signed_blob.hex());
+        sig->set_public_key(public_key.hex());
+        if (blob_) {
+          replaced_blobs_.push_back(std::move(blob_));
+        }
+      }
+
+      // values below are computed on first access, which may happen
+      // concurrently from several threads
+
+      /// guards blob_, replaced_blobs_ and signatures of proto_
+      std::mutex blob_mutex_;
+      std::unique_ptr<const interface::types::BlobType> blob_;
+      std::vector<std::unique_ptr<const interface::types::BlobType>>
+          replaced_blobs_;
+
+      std::once_flag payload_blob_once_;
+      boost::optional<interface::types::BlobType> payload_blob_;
+
+      std::once_flag reduced_payload_blob_once_;
+      boost::optional<interface::types::BlobType> reduced_payload_blob_;
+
+      std::once_flag reduced_hash_once_;
+      boost::optional<interface::types::HashType> reduced_hash_;
+
+      std::once_flag commands_once_;
+      boost::optional<std::vector<proto::Command>> commands_;
 
       boost::optional<std::shared_ptr<interface::BatchMeta>> meta_{
           [this]() -> boost::optional<std::shared_ptr<interface::BatchMeta>> {
@@ -71,6 +138,11 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(std::move(transaction));
     }
 
+    Transaction::Transaction(
+        std::reference_wrapper<TransportType> transaction) {
+      impl_ = std::make_unique<Transaction::Impl>(transaction.get());
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
@@ -86,19 +158,19 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return impl_->commands();
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return impl_->blob();
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return impl_->payloadBlob();
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return impl_->reducedPayloadBlob();
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
@@ -106,7 +178,7 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return impl_->reducedHash();
     }
 
     bool Transaction::addSignature(const crypto::Signed &signed_blob,
@@ -121,9 +193,7 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_->add_signatures();
-      sig->set_signature(signed_blob.hex());
-      sig->set_public_key(public_key.hex());
+      impl_->addSignature(signed_blob, public_key);
 
       impl_->signatures_ = [this] {
         auto signatures = impl_->proto_->signatures()
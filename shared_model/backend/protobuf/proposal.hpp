@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 #define IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 
+#include <google/protobuf/arena.h>
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "proposal.pb.h"
@@ -22,6 +23,16 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Create proposal from the transport object allocated in the arena.
+       * The arena is owned by the proposal, so the whole transport object is
+       * freed at once together with the proposal
+       * @param arena - arena of the transport object
+       * @param ref - transport object allocated in the arena
+       */
+      Proposal(std::unique_ptr<google::protobuf::Arena> arena,
+               TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -28,7 +28,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
+        return validate(
             createProtoProposal(height, created_time, transactions));
       }
 
@@ -36,8 +36,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return createProtoProposal(height, created_time, transactions);
       }
 
       /**
@@ -49,11 +48,17 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Create proposal with the transport object allocated in an arena, so
+       * that copies of the transactions are not allocated one by one
+       */
+      std::unique_ptr<Proposal> createProtoProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
+        auto arena = std::make_unique<google::protobuf::Arena>();
+        auto &proposal = *google::protobuf::Arena::CreateMessage<
+            iroha::protocol::Proposal>(arena.get());
 
         proposal.set_height(height);
         proposal.set_created_time(created_time);
@@ -64,7 +69,7 @@ namespace shared_model {
                   .getTransport();
         }
 
-        return proposal;
+        return std::make_unique<Proposal>(std::move(arena), proposal);
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_TRANSACTION_HPP
 #define IROHA_SHARED_MODEL_PROTO_TRANSACTION_HPP
 
+#include <functional>
+
 #include "interfaces/transaction.hpp"
 #include "transaction.pb.h"
 
@@ -20,6 +22,13 @@ namespace shared_model {
 
       explicit Transaction(TransportType &&transaction);
 
+      /**
+       * Wrap the transport object without copying it
+       * @param transaction - transport object, which must outlive the created
+       * transaction, e.g. a part of a proposal or a block
+       */
+      explicit Transaction(std::reference_wrapper<TransportType> transaction);
+
       Transaction(const Transaction &transaction);
 
       Transaction(Transaction &&o) noexcept;
@@ -40,6 +49,10 @@ namespace shared_model {
 
       const interface::types::HashType &reducedHash() const override;
 
+      /**
+       * Blobs returned earlier stay valid. Must not race with signatures()
+       * and getTransport(), which are not guarded
+       */
       bool addSignature(const crypto::Signed &signed_blob,
                         const crypto::PublicKey &public_key) override;
 
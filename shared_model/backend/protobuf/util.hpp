@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
 #include <vector>
 #include "cryptography/blob.hpp"
@@ -21,6 +22,18 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Copy the message into the arena, so that all its submessages are freed
+     * together with the arena
+     * @return copy of the message, which lives as long as the arena
+     */
+    template <typename T>
+    T &copyToArena(const T &message, google::protobuf::Arena &arena) {
+      auto *copy = google::protobuf::Arena::CreateMessage<T>(&arena);
+      copy->CopyFrom(message);
+      return *copy;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
@@ -6,7 +6,10 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <vector>
+
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -36,6 +39,16 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify a batch of signatures
+       * @param entries - signatures with their source data and signatories
+       * @return indices of incorrect signatures in ascending order
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<VerificationEntry> &entries) {
+        return Algorithm::verifyBatch(entries);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
@@ -0,0 +1,152 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CRYPTO_VERIFIER_POOL_HPP
+#define IROHA_CRYPTO_VERIFIER_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * CryptoVerifierPool - verifies batches of signatures on a fixed set of
+     * threads, so that all signatures of a proposal or a block can be checked
+     * at once. Batches are split into chunks, one of them is verified by the
+     * calling thread
+     * @tparam Algorithm - cryptographic algorithm for verification
+     */
+    template <typename Algorithm = DefaultCryptoAlgorithmType>
+    class CryptoVerifierPool {
+     public:
+      /// batches smaller than that are not split
+      static constexpr size_t kDefaultMinChunkSize = 16;
+
+      /**
+       * @param threads - number of threads verifying signatures besides the
+       * calling one
+       * @param min_chunk_size - minimal number of signatures in a chunk
+       */
+      explicit CryptoVerifierPool(
+          size_t threads, size_t min_chunk_size = kDefaultMinChunkSize)
+          : min_chunk_size_(std::max<size_t>(min_chunk_size, 1)) {
+        for (size_t i = 0; i < threads; ++i) {
+          threads_.emplace_back([this] { work(); });
+        }
+      }
+
+      CryptoVerifierPool(const CryptoVerifierPool &) = delete;
+      CryptoVerifierPool &operator=(const CryptoVerifierPool &) = delete;
+
+      ~CryptoVerifierPool() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto &thread : threads_) {
+          thread.join();
+        }
+      }
+
+      /**
+       * Verify a batch of signatures, may be called from several threads
+       * @param entries - signatures with their source data and signatories
+       * @return indices of incorrect signatures in ascending order
+       */
+      std::vector<size_t> verify(
+          const std::vector<VerificationEntry> &entries) {
+        auto chunks = std::min(threads_.size() + 1,
+                               (entries.size() + min_chunk_size_ - 1)
+                                   / min_chunk_size_);
+        if (chunks < 2) {
+          return CryptoVerifier<Algorithm>::verifyBatch(entries);
+        }
+        auto chunk_size = (entries.size() + chunks - 1) / chunks;
+
+        std::vector<std::future<std::vector<size_t>>> results;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          for (size_t begin = chunk_size; begin < entries.size();
+               begin += chunk_size) {
+            auto end = std::min(begin + chunk_size, entries.size());
+            tasks_.emplace_back([&entries, begin, end] {
+              return verifyChunk(entries, begin, end);
+            });
+            results.push_back(tasks_.back().get_future());
+          }
+        }
+        condition_.notify_all();
+
+        auto invalid = verifyChunk(entries, 0, chunk_size);
+        for (auto &result : results) {
+          auto chunk_invalid = result.get();
+          invalid.insert(
+              invalid.end(), chunk_invalid.begin(), chunk_invalid.end());
+        }
+        return invalid;
+      }
+
+     private:
+      using Task = std::packaged_task<std::vector<size_t>()>;
+
+      /**
+       * Verify entries in range [begin, end)
+       * @return indices of incorrect signatures in the whole batch
+       */
+      static std::vector<size_t> verifyChunk(
+          const std::vector<VerificationEntry> &entries,
+          size_t begin,
+          size_t end) {
+        auto invalid = CryptoVerifier<Algorithm>::verifyBatch(
+            std::vector<VerificationEntry>(entries.begin() + begin,
+                                           entries.begin() + end));
+        for (auto &index : invalid) {
+          index += begin;
+        }
+        return invalid;
+      }
+
+      void work() {
+        while (true) {
+          Task task;
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock,
+                            [this] { return stop_ or not tasks_.empty(); });
+            if (tasks_.empty()) {
+              return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+          }
+          task();
+        }
+      }
+
+      const size_t min_chunk_size_;
+
+      std::mutex mutex_;
+      std::condition_variable condition_;
+      std::deque<Task> tasks_;
+      bool stop_ = false;
+      std::vector<std::thread> threads_;
+    };
+
+    template <typename Algorithm>
+    constexpr size_t CryptoVerifierPool<Algorithm>::kDefaultMinChunkSize;
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_CRYPTO_VERIFIER_POOL_HPP
@@ -6,9 +6,12 @@
 #ifndef IROHA_CRYPTOPROVIDER_HPP
 #define IROHA_CRYPTOPROVIDER_HPP
 
+#include <vector>
+
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -35,6 +38,15 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies a batch of signatures.
+       * @param entries - signatures to verify
+       * @return indices of invalid signatures in ascending order
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<VerificationEntry> &entries);
+
       /**
        * Generates new seed
        * @return Seed generated
@@ -4,6 +4,9 @@
  */
 
 #include "verifier.hpp"
+
+#include <algorithm>
+
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
@@ -17,5 +20,37 @@ namespace shared_model {
           iroha::pubkey_t::from_string(toBinaryString(publicKey)),
           iroha::sig_t::from_string(toBinaryString(signedData)));
     }
+
+    std::vector<size_t> Verifier::verifyBatch(
+        const std::vector<VerificationEntry> &entries) {
+      std::vector<size_t> invalid;
+      const Blob *hashed_source = nullptr;
+      iroha::hash256_t hash;
+      iroha::pubkey_t pubkey;
+      iroha::sig_t signature;
+      for (size_t i = 0; i < entries.size(); ++i) {
+        const auto &entry = entries[i];
+        const auto &signature_bytes = entry.signed_data.blob();
+        const auto &pubkey_bytes = entry.public_key.blob();
+        if (signature_bytes.size() != signature.size()
+            or pubkey_bytes.size() != pubkey.size()) {
+          invalid.push_back(i);
+          continue;
+        }
+        // signatures of one object are usually adjacent
+        if (hashed_source != &entry.source) {
+          const auto &source = entry.source.blob();
+          hash = iroha::sha3_256(source.data(), source.size());
+          hashed_source = &entry.source;
+        }
+        std::copy(
+            signature_bytes.begin(), signature_bytes.end(), signature.begin());
+        std::copy(pubkey_bytes.begin(), pubkey_bytes.end(), pubkey.begin());
+        if (not iroha::verify(hash.data(), hash.size(), pubkey, signature)) {
+          invalid.push_back(i);
+        }
+      }
+      return invalid;
+    }
   }  // namespace crypto
 }  // namespace shared_model
@@ -6,8 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_VERIFIER_HPP
 #define IROHA_SHARED_MODEL_VERIFIER_HPP
 
+#include <vector>
+
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -19,6 +22,16 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify a batch of signatures. The ed25519 library provides no batch
+       * equation, so signatures are checked one by one, hashing each distinct
+       * source once and without intermediate string copies
+       * @param entries - signatures to verify
+       * @return indices of invalid signatures in ascending order
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<VerificationEntry> &entries);
     };
 
   }  // namespace crypto
@@ -110,6 +110,13 @@ namespace shared_model {
     using DefaultProposalValidator =
         ProposalValidator<FieldValidator, DefaultSignedTransactionsValidator>;
 
+    /**
+     * Proposal validator which checks stateless validation of proposal
+     * WITHOUT signatures of transactions
+     */
+    using DefaultUnsignedProposalValidator =
+        ProposalValidator<FieldValidator, DefaultUnsignedTransactionsValidator>;
+
     /**
      * Block validator which checks blocks WITHOUT signatures. Note that it does
      * not check transactions' signatures as well
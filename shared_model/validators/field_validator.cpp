@@ -305,6 +305,19 @@ namespace shared_model {
         ReasonsGroupType &reason,
         const interface::types::SignatureRangeType &signatures,
         const crypto::Blob &source) const {
+      std::vector<crypto::VerificationEntry> entries;
+      collectSignatures(reason, signatures, source, entries);
+      for (auto index :
+           shared_model::crypto::CryptoVerifier<>::verifyBatch(entries)) {
+        reason.second.push_back(wrongSignature(entries[index]));
+      }
+    }
+
+    void FieldValidator::collectSignatures(
+        ReasonsGroupType &reason,
+        const interface::types::SignatureRangeType &signatures,
+        const crypto::Blob &source,
+        std::vector<crypto::VerificationEntry> &entries) const {
       if (boost::empty(signatures)) {
         reason.second.emplace_back("Signatures cannot be empty");
       }
@@ -325,16 +338,19 @@ namespace shared_model {
           is_valid = false;
         }
 
-        if (is_valid
-            && not shared_model::crypto::CryptoVerifier<>::verify(
-                   sign, source, pkey)) {
-          reason.second.push_back((boost::format("Wrong signature [%s;%s]")
-                                   % sign.hex() % pkey.hex())
-                                      .str());
+        if (is_valid) {
+          entries.push_back({sign, source, pkey});
         }
       }
     }
 
+    ConcreteReasonType FieldValidator::wrongSignature(
+        const crypto::VerificationEntry &entry) {
+      return (boost::format("Wrong signature [%s;%s]")
+              % entry.signed_data.hex() % entry.public_key.hex())
+          .str();
+    }
+
     void FieldValidator::validateQueryPayloadMeta(
         ReasonsGroupType &reason,
         const interface::QueryPayloadMeta &meta) const {}
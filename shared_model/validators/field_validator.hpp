@@ -8,6 +8,7 @@
 
 #include <regex>
 
+#include "cryptography/verification_entry.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/base/signable.hpp"
 #include "interfaces/permissions.hpp"
@@ -144,6 +145,23 @@ namespace shared_model {
           const interface::types::SignatureRangeType &signatures,
           const crypto::Blob &source) const;
 
+      /**
+       * Check the form of signatures without verifying them
+       * @param entries - well-formed signatures are appended to it, so they
+       * can be verified later together with signatures of other models
+       */
+      void collectSignatures(
+          ReasonsGroupType &reason,
+          const interface::types::SignatureRangeType &signatures,
+          const crypto::Blob &source,
+          std::vector<crypto::VerificationEntry> &entries) const;
+
+      /**
+       * @return reason for a signature which failed verification
+       */
+      static ConcreteReasonType wrongSignature(
+          const crypto::VerificationEntry &entry);
+
       void validateQueryPayloadMeta(
           ReasonsGroupType &reason,
           const interface::QueryPayloadMeta &meta) const;
@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POOLED_SIGNATURES_VALIDATOR_HPP
+#define IROHA_POOLED_SIGNATURES_VALIDATOR_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/format.hpp>
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
+#include "validators/abstract_validator.hpp"
+#include "validators/field_validator.hpp"
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Validator of a model with transactions, e.g. a proposal, which hands
+     * signatures of all transactions to a verifier pool at once instead of
+     * verifying them transaction by transaction on the calling thread
+     * @tparam Model - type of validated model
+     * @tparam UnsignedValidator - validator of the model which does not
+     * check signatures of transactions
+     */
+    template <typename Model,
+              typename UnsignedValidator,
+              typename FieldValidator = validation::FieldValidator>
+    class PooledSignaturesValidator : public AbstractValidator<Model> {
+     public:
+      explicit PooledSignaturesValidator(
+          std::shared_ptr<crypto::CryptoVerifierPool<>> verifier_pool,
+          UnsignedValidator validator = UnsignedValidator(),
+          FieldValidator field_validator = FieldValidator())
+          : verifier_pool_(std::move(verifier_pool)),
+            validator_(std::move(validator)),
+            field_validator_(std::move(field_validator)) {}
+
+      Answer validate(const Model &model) const override {
+        auto answer = validator_.validate(model);
+
+        // reasons of each transaction, and the transaction of each entry
+        std::vector<ReasonsGroupType> reasons;
+        std::vector<crypto::VerificationEntry> entries;
+        std::vector<size_t> owners;
+        for (const auto &tx : model.transactions()) {
+          reasons.emplace_back("Signature", GroupedReasons());
+          field_validator_.collectSignatures(
+              reasons.back(), tx.signatures(), tx.payload(), entries);
+          owners.resize(entries.size(), reasons.size() - 1);
+        }
+        for (auto index : verifier_pool_->verify(entries)) {
+          reasons[owners[index]].second.push_back(
+              FieldValidator::wrongSignature(entries[index]));
+        }
+
+        ReasonsGroupType reason;
+        reason.first = "Transaction signatures";
+        auto tx_reason = reasons.begin();
+        for (const auto &tx : model.transactions()) {
+          if (not tx_reason->second.empty()) {
+            Answer tx_answer;
+            tx_answer.addReason(std::move(*tx_reason));
+            reason.second.push_back((boost::format("Tx %s : %s")
+                                     % tx.hash().hex() % tx_answer.reason())
+                                        .str());
+          }
+          ++tx_reason;
+        }
+        if (not reason.second.empty()) {
+          answer.addReason(std::move(reason));
+        }
+        return answer;
+      }
+
+     private:
+      std::shared_ptr<crypto::CryptoVerifierPool<>> verifier_pool_;
+      UnsignedValidator validator_;
+      FieldValidator field_validator_;
+    };
+
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_POOLED_SIGNATURES_VALIDATOR_HPP
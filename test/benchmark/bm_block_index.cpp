@@ -0,0 +1,276 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Measures latency of the block index lookups used by tx presence check and
+ * GetAccountTransactions while the ledger grows up to 10M transactions.
+ * Index tables are filled directly in postgres, each account has a fixed
+ * number of transactions, so the latency should not depend on the ledger size.
+ *
+ * Also measures PostgresBlockIndex::index for a block of 5000 transfers.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <random>
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_block_query.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "datetime/time.hpp"
+#include "framework/config_helper.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/field_validator.hpp"
+
+using namespace iroha::ametsuchi;
+
+/// number of transactions in a single block
+constexpr int64_t txs_per_block = 100;
+/// number of transactions created by a single account
+constexpr int64_t txs_per_account = 1000;
+/// number of transactions inserted by a single statement
+constexpr int64_t fill_chunk = 1000000;
+
+/**
+ * Database with block index tables which is shared between runs and only
+ * grows, so that ledger of 10M transactions is filled once
+ */
+class Ledger {
+ public:
+  Ledger() {
+    auto factory =
+        std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+            shared_model::validation::FieldValidator>>();
+    auto converter =
+        std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
+    StorageImpl::create(
+        block_store_path,
+        pgopt,
+        factory,
+        converter,
+        std::make_shared<shared_model::proto::ProtoPermissionToString>())
+        .match(
+            [&](iroha::expected::Value<std::shared_ptr<StorageImpl>> &v) {
+              storage = v.value;
+            },
+            [](const iroha::expected::Error<std::string> &e) {
+              throw std::runtime_error(e.error);
+            });
+    sql = std::make_unique<soci::session>(soci::postgresql, pgopt);
+    block_store = std::move(*FlatFile::create(block_store_path + "_query"));
+    block_query = std::make_unique<PostgresBlockQuery>(
+        *sql, *block_store, converter);
+  }
+
+  ~Ledger() {
+    block_query.reset();
+    sql->close();
+    storage->dropStorage();
+    boost::filesystem::remove_all(block_store_path);
+    boost::filesystem::remove_all(block_store_path + "_query");
+  }
+
+  /**
+   * Insert index entries for transactions up to the given ledger size
+   */
+  void grow(int64_t size) {
+    while (filled < size) {
+      auto to = std::min(size, filled + fill_chunk);
+      *sql << (boost::format(R"(
+INSERT INTO position_by_hash(hash, height, index)
+SELECT md5(i::text) || md5((i + 1)::text), i / %1% + 1, i %% %1%
+FROM generate_series(%3%, %4%) i;
+INSERT INTO tx_status_by_hash(hash, status)
+SELECT md5(i::text) || md5((i + 1)::text), TRUE
+FROM generate_series(%3%, %4%) i;
+INSERT INTO index_by_creator_height(creator_id, height, index)
+SELECT 'user' || i / %2% || '@bench', i / %1% + 1, i %% %1%
+FROM generate_series(%3%, %4%) i;
+ANALYZE;
+)") % txs_per_block % txs_per_account % filled % (to - 1))
+                  .str();
+      filled = to;
+    }
+  }
+
+  /**
+   * @return hash of transaction with the given number
+   */
+  std::string hash(int64_t i) {
+    std::string result;
+    *sql << (boost::format("SELECT md5('%1%') || md5('%2%')") % i % (i + 1))
+                .str(),
+        soci::into(result);
+    return result;
+  }
+
+  std::string block_store_path =
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string();
+  std::string pgopt = "dbname=d"
+      + boost::uuids::to_string(boost::uuids::random_generator()())
+            .substr(0, 8)
+      + " " + integration_framework::getPostgresCredsOrDefault();
+  std::shared_ptr<StorageImpl> storage;
+  std::unique_ptr<soci::session> sql;
+  std::unique_ptr<FlatFile> block_store;
+  std::unique_ptr<PostgresBlockQuery> block_query;
+  int64_t filled = 0;
+};
+
+static Ledger &ledger() {
+  static Ledger ledger;
+  return ledger;
+}
+
+class BlockIndexBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    ledger().grow(st.range(0));
+  }
+
+  /**
+   * @return number of a random transaction in the ledger
+   */
+  int64_t randomTx(benchmark::State &st) {
+    return std::uniform_int_distribution<int64_t>(0, st.range(0) - 1)(rng);
+  }
+
+  std::mt19937_64 rng{42};
+};
+
+/**
+ * Benchmark presence check of a committed transaction
+ */
+BENCHMARK_DEFINE_F(BlockIndexBenchmark, CheckTxPresence)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    auto hash = shared_model::crypto::Hash::fromHexString(
+        ledger().hash(randomTx(st)));
+    st.ResumeTiming();
+    benchmark::DoNotOptimize(ledger().block_query->checkTxPresence(hash));
+  }
+}
+
+/**
+ * Benchmark selection of a page of account transactions starting from a
+ * random transaction, the same way GetAccountTransactions query does
+ */
+BENCHMARK_DEFINE_F(BlockIndexBenchmark, AccountTransactionsPage)
+(benchmark::State &st) {
+  const std::string query = R"(WITH my_txs AS (
+        SELECT DISTINCT height, index
+        FROM index_by_creator_height
+        WHERE creator_id = :account_id
+        ORDER BY height, index ASC
+      ),
+      first_hash AS (SELECT height, index FROM position_by_hash
+        WHERE hash = :hash LIMIT 1),
+      total_size AS (
+        SELECT COUNT(*) FROM my_txs
+      ),
+      t AS (
+        SELECT my_txs.height, my_txs.index
+        FROM my_txs JOIN
+        first_hash ON my_txs.height > first_hash.height
+        OR (my_txs.height = first_hash.height AND
+            my_txs.index >= first_hash.index)
+        LIMIT :page_size
+      )
+      SELECT height, index, count FROM t
+      JOIN total_size ON TRUE
+      )";
+  const long long page_size = 101;
+  std::vector<long long> heights(page_size), indices(page_size),
+      counts(page_size);
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    auto tx = randomTx(st);
+    auto account_id = "user" + std::to_string(tx / txs_per_account) + "@bench";
+    auto hash = ledger().hash(tx);
+    st.ResumeTiming();
+    *ledger().sql << query, soci::use(account_id, "account_id"),
+        soci::use(hash, "hash"), soci::use(page_size, "page_size"),
+        soci::into(heights), soci::into(indices), soci::into(counts);
+    benchmark::DoNotOptimize(heights);
+  }
+}
+
+class BlockIndexWriteBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto now = iroha::time::now();
+    std::vector<shared_model::proto::Transaction> txs;
+    for (int64_t i = 0; i < st.range(0); i++) {
+      txs.push_back(TestTransactionBuilder()
+                        .createdTime(now + i)
+                        .creatorAccountId("user" + std::to_string(i % 100)
+                                          + "@bench")
+                        .quorum(1)
+                        .transferAsset("user" + std::to_string(i % 100)
+                                           + "@bench",
+                                       "user" + std::to_string(i % 99)
+                                           + "@bench",
+                                       "coin#bench",
+                                       "",
+                                       "1.00")
+                        .build());
+    }
+    block = std::make_unique<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .createdTime(now)
+            .height(std::numeric_limits<int32_t>::max())
+            .transactions(txs)
+            .build());
+  }
+
+  std::unique_ptr<shared_model::proto::Block> block;
+};
+
+/**
+ * Benchmark indexing of a block, each run is rolled back to keep the index
+ * tables unchanged
+ */
+BENCHMARK_DEFINE_F(BlockIndexWriteBenchmark, Index)(benchmark::State &st) {
+  auto &sql = *ledger().sql;
+  PostgresBlockIndex index(sql);
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    sql << "BEGIN";
+    st.ResumeTiming();
+    index.index(*block);
+    st.PauseTiming();
+    sql << "ROLLBACK";
+    st.ResumeTiming();
+  }
+}
+
+BENCHMARK_REGISTER_F(BlockIndexBenchmark, CheckTxPresence)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(BlockIndexBenchmark, AccountTransactionsPage)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(BlockIndexWriteBenchmark, Index)
+    ->Arg(5000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Compares write and read throughput of the block store for blocks kept in
+ * the legacy json format and in the binary block file format.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+
+/// number of transactions in a single block
+constexpr int number_of_txs = 10000;
+
+class BlockStorageBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+    auto base_tx = txbuilder.createdTime(iroha::time::now())
+                       .quorum(1)
+                       .transferAsset(
+                           "player@one", "player@two", "coin", "", "5.00");
+
+    std::vector<shared_model::proto::Transaction> txs;
+    for (int i = 0; i < number_of_txs; i++) {
+      txs.push_back(base_tx.build());
+    }
+
+    block = std::make_unique<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .createdTime(iroha::time::now())
+            .height(1)
+            .transactions(txs)
+            .build());
+
+    boost::filesystem::create_directory(block_store_path);
+    store = std::move(*FlatFile::create(block_store_path));
+  }
+
+  void TearDown(benchmark::State &st) override {
+    store.reset();
+    boost::filesystem::remove_all(block_store_path);
+  }
+
+  /**
+   * Serialize and write the block under the next free id
+   */
+  template <typename Serializer>
+  void write(Serializer &&serialize) {
+    store->add(store->last_id() + 1, serialize(*block));
+  }
+
+  std::string block_store_path =
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string();
+  std::shared_ptr<shared_model::proto::ProtoBlockJsonConverter> converter =
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
+  BlockFileFormat format{converter};
+  std::unique_ptr<shared_model::proto::Block> block;
+  std::unique_ptr<FlatFile> store;
+};
+
+auto json_serializer(const shared_model::proto::ProtoBlockJsonConverter &c) {
+  return [&c](const shared_model::interface::Block &block) {
+    return c.serialize(block).match(
+        [](iroha::expected::Value<std::string> &v) {
+          return iroha::stringToBytes(v.value);
+        },
+        [](const auto &) { return KeyValueStorage::Bytes{}; });
+  };
+}
+
+auto binary_serializer(const BlockFileFormat &f) {
+  return [&f](const shared_model::interface::Block &block) {
+    return f.serialize(block).match(
+        [](iroha::expected::Value<KeyValueStorage::Bytes> &v) {
+          return std::move(v.value);
+        },
+        [](const auto &) { return KeyValueStorage::Bytes{}; });
+  };
+}
+
+/**
+ * Benchmark serialization and writing of blocks as json
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, JsonWrite)(benchmark::State &st) {
+  auto serialize = json_serializer(*converter);
+  while (st.KeepRunning()) {
+    write(serialize);
+  }
+}
+
+/**
+ * Benchmark serialization and writing of blocks in binary format
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, BinaryWrite)(benchmark::State &st) {
+  auto serialize = binary_serializer(format);
+  while (st.KeepRunning()) {
+    write(serialize);
+  }
+}
+
+/**
+ * Benchmark reading and parsing of a block stored as json
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, JsonRead)(benchmark::State &st) {
+  write(json_serializer(*converter));
+  while (st.KeepRunning()) {
+    auto record = store->get(1);
+    benchmark::DoNotOptimize(
+        converter->deserialize(iroha::bytesToString(*record)));
+  }
+}
+
+/**
+ * Benchmark reading and parsing of a block stored in binary format
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, BinaryRead)(benchmark::State &st) {
+  write(binary_serializer(format));
+  while (st.KeepRunning()) {
+    auto record = store->get(1);
+    benchmark::DoNotOptimize(format.deserialize(*record));
+  }
+}
+
+/**
+ * Benchmark parsing of a block stored in binary format straight from the
+ * memory-mapped file
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, BinaryViewRead)
+(benchmark::State &st) {
+  write(binary_serializer(format));
+  while (st.KeepRunning()) {
+    auto view = store->getView(1);
+    benchmark::DoNotOptimize(
+        format.deserialize((*view)->data(), (*view)->size()));
+  }
+}
+
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, JsonWrite)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, BinaryWrite)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, JsonRead)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, BinaryRead)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, BinaryViewRead)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,142 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Measures validation of a proposal of 1000 single-command transactions in
+ * temporary wsv, with commands sent to the database one by one (argument 0)
+ * and with commands of each transaction sent in a single round trip
+ * (argument 1).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "framework/config_helper.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "validators/field_validator.hpp"
+
+using namespace iroha::ametsuchi;
+using Role = shared_model::interface::permissions::Role;
+
+/// number of transactions in the proposal
+constexpr size_t proposal_size = 1000;
+
+class CommandBatchingBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto factory =
+        std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+            shared_model::validation::FieldValidator>>();
+    StorageImpl::create(
+        block_store_path,
+        pgopt,
+        factory,
+        std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+        std::make_shared<shared_model::proto::ProtoPermissionToString>())
+        .match(
+            [&](iroha::expected::Value<std::shared_ptr<StorageImpl>> &v) {
+              storage = v.value;
+            },
+            [](const iroha::expected::Error<std::string> &e) {
+              throw std::runtime_error(e.error);
+            });
+
+    std::vector<shared_model::proto::Transaction> genesis_tx;
+    genesis_tx.push_back(
+        shared_model::proto::TransactionBuilder()
+            .creatorAccountId("admin@bench")
+            .createdTime(iroha::time::now())
+            .quorum(1)
+            .createRole("user", {Role::kReceive, Role::kTransfer})
+            .createDomain("bench", "user")
+            .createAccount("admin", "bench", key.publicKey())
+            .createAccount("user", "bench", key.publicKey())
+            .createAsset("coin", "bench", 2)
+            .addAssetQuantity("coin#bench", "1000000.00")
+            .build()
+            .signAndAddSignature(key)
+            .finish());
+    storage->insertBlock(TestBlockBuilder()
+                             .transactions(genesis_tx)
+                             .height(1)
+                             .createdTime(iroha::time::now())
+                             .build());
+    storage->setCommandBatching(st.range(0) != 0);
+
+    auto now = iroha::time::now();
+    for (size_t i = 0; i < proposal_size; ++i) {
+      txs.push_back(shared_model::proto::TransactionBuilder()
+                        .creatorAccountId("admin@bench")
+                        .createdTime(now + i)
+                        .quorum(1)
+                        .transferAsset("admin@bench",
+                                       "user@bench",
+                                       "coin#bench",
+                                       "",
+                                       "0.01")
+                        .build()
+                        .signAndAddSignature(key)
+                        .finish());
+    }
+  }
+
+  void TearDown(benchmark::State &) override {
+    txs.clear();
+    storage->dropStorage();
+    storage.reset();
+    boost::filesystem::remove_all(block_store_path);
+  }
+
+  shared_model::crypto::Keypair key =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  std::string block_store_path =
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string();
+  std::string pgopt = "dbname=d"
+      + boost::uuids::to_string(boost::uuids::random_generator()())
+            .substr(0, 8)
+      + " " + integration_framework::getPostgresCredsOrDefault();
+  std::shared_ptr<StorageImpl> storage;
+  std::vector<shared_model::proto::Transaction> txs;
+};
+
+/**
+ * Benchmark application of the proposal to temporary wsv, the wsv is
+ * created and rolled back outside of the measured time
+ */
+BENCHMARK_DEFINE_F(CommandBatchingBenchmark, ValidateProposal)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    auto wsv = std::move(
+        boost::get<iroha::expected::Value<std::unique_ptr<TemporaryWsv>>>(
+            storage->createTemporaryWsv())
+            .value);
+    st.ResumeTiming();
+    for (const auto &tx : txs) {
+      benchmark::DoNotOptimize(wsv->apply(tx));
+    }
+    st.PauseTiming();
+    wsv.reset();
+    st.ResumeTiming();
+  }
+}
+
+BENCHMARK_REGISTER_F(CommandBatchingBenchmark, ValidateProposal)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Measures verification of 1000 signatures of distinct messages one by one,
+ * as a single batch, and as a batch split over a pool of threads given by
+ * the argument. Items processed are signatures.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
+
+using namespace shared_model::crypto;
+
+/// number of signatures verified in each iteration
+constexpr size_t batch_size = 1000;
+
+class CryptoBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &) override {
+    sources.reserve(batch_size);
+    signatures.reserve(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+      sources.emplace_back("transaction payload " + std::to_string(i));
+      signatures.push_back(
+          DefaultCryptoAlgorithmType::sign(sources.back(), keypair));
+    }
+    for (size_t i = 0; i < batch_size; ++i) {
+      entries.push_back({signatures[i], sources[i], keypair.publicKey()});
+    }
+  }
+
+  void TearDown(benchmark::State &) override {
+    entries.clear();
+    signatures.clear();
+    sources.clear();
+  }
+
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  std::vector<Blob> sources;
+  std::vector<Signed> signatures;
+  std::vector<VerificationEntry> entries;
+};
+
+BENCHMARK_DEFINE_F(CryptoBenchmark, Sequential)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    for (const auto &entry : entries) {
+      benchmark::DoNotOptimize(CryptoVerifier<>::verify(
+          entry.signed_data, entry.source, entry.public_key));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * batch_size);
+}
+
+BENCHMARK_DEFINE_F(CryptoBenchmark, Batch)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(CryptoVerifier<>::verifyBatch(entries));
+  }
+  st.SetItemsProcessed(st.iterations() * batch_size);
+}
+
+BENCHMARK_DEFINE_F(CryptoBenchmark, Pool)(benchmark::State &st) {
+  CryptoVerifierPool<> pool(st.range(0));
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(pool.verify(entries));
+  }
+  st.SetItemsProcessed(st.iterations() * batch_size);
+}
+
+BENCHMARK_REGISTER_F(CryptoBenchmark, Sequential)->UseRealTime();
+BENCHMARK_REGISTER_F(CryptoBenchmark, Batch)->UseRealTime();
+BENCHMARK_REGISTER_F(CryptoBenchmark, Pool)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(7)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
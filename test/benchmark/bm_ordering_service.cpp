@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stress test of the on-demand ordering service: the number of threads given
+ * by the argument keep sending batches, like peers forwarding the same
+ * transactions, while the benchmark thread completes rounds and requests
+ * their proposals. Transaction presence checks take about as long as a query
+ * to the storage. Iteration time is the latency of a collaboration outcome,
+ * items processed are received batches.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "ametsuchi/tx_presence_cache.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+
+using namespace iroha::ordering;
+
+/// number of batches sent at once by a producer
+constexpr size_t batches_per_call = 10;
+/// number of different batches sent by all producers
+constexpr size_t batches_count = 1000;
+/// pause between sends of a producer
+constexpr std::chrono::milliseconds send_interval(1);
+/// simulated duration of a storage query
+constexpr std::chrono::microseconds check_duration(10);
+
+/**
+ * Transaction presence cache which finds nothing after a delay
+ */
+class SlowTxPresenceCache : public iroha::ametsuchi::TxPresenceCache {
+ public:
+  boost::optional<iroha::ametsuchi::TxCacheStatusType> check(
+      const shared_model::crypto::Hash &hash) const override {
+    std::this_thread::sleep_for(check_duration);
+    return iroha::ametsuchi::TxCacheStatusType(
+        iroha::ametsuchi::tx_cache_status_responses::Missing{hash});
+  }
+
+  boost::optional<BatchStatusCollectionType> check(
+      const shared_model::interface::TransactionBatch &batch) const override {
+    std::this_thread::sleep_for(check_duration);
+    BatchStatusCollectionType result;
+    for (const auto &tx : batch.transactions()) {
+      result.push_back(
+          iroha::ametsuchi::tx_cache_status_responses::Missing{tx->hash()});
+    }
+    return result;
+  }
+};
+
+/**
+ * Generate distinct single transaction batches
+ */
+std::vector<OnDemandOrderingService::TransactionBatchType> generateBatches(
+    size_t count) {
+  auto keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  static std::atomic<size_t> counter{0};
+  auto now = iroha::time::now();
+  std::vector<OnDemandOrderingService::TransactionBatchType> batches;
+  for (size_t i = 0; i < count; ++i) {
+    batches.push_back(
+        std::make_shared<shared_model::interface::TransactionBatchImpl>(
+            shared_model::interface::types::SharedTxsCollectionType{
+                std::make_shared<shared_model::proto::Transaction>(
+                    shared_model::proto::TransactionBuilder()
+                        .createdTime(now + counter++)
+                        .creatorAccountId("admin@bench")
+                        .createAsset("coin", "bench", 1)
+                        .quorum(1)
+                        .build()
+                        .signAndAddSignature(keypair)
+                        .finish())}));
+  }
+  return batches;
+}
+
+static void BM_ConcurrentOnBatches(benchmark::State &state) {
+  const size_t producers = state.range(0);
+  auto batches = generateBatches(batches_count);
+
+  OnDemandOrderingServiceImpl os(
+      1000,
+      std::make_shared<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::AlwaysValidValidator>>(),
+      std::make_shared<SlowTxPresenceCache>(),
+      3,
+      {2, kFirstRejectRound},
+      std::make_shared<FifoPackingPolicy>(),
+      0);
+
+  std::atomic<iroha::consensus::BlockRoundType> block_round{2};
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> sent{0};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < producers; ++i) {
+    threads.emplace_back([&, i] {
+      auto offset = i * batches_per_call % batches_count;
+      while (not stop) {
+        OnDemandOrderingService::CollectionType collection(
+            batches.begin() + offset,
+            batches.begin() + offset + batches_per_call);
+        os.onBatches({block_round + 2, kNextCommitRoundConsumer},
+                     std::move(collection));
+        sent += batches_per_call;
+        offset = (offset + batches_per_call) % batches_count;
+        std::this_thread::sleep_for(send_interval);
+      }
+    });
+  }
+
+  while (state.KeepRunning()) {
+    iroha::consensus::Round round{block_round, kFirstRejectRound};
+    os.onCollaborationOutcome(round);
+    benchmark::DoNotOptimize(
+        os.onRequestProposal({round.block_round + 1, kFirstRejectRound}));
+    ++block_round;
+  }
+
+  stop = true;
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  state.SetItemsProcessed(sent);
+}
+
+BENCHMARK(BM_ConcurrentOnBatches)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -13,23 +13,57 @@
  * to blocks and proposals copying/moving.
  * 
  * Each benchmark runs transaction() and commands() call to 
- * initialize possibly lazy fields.
+ * initialize possibly lazy fields, except for construction benchmarks, which
+ * measure the cost paid by objects whose lazy fields are never read.
+ *
+ * Besides time, each benchmark reports the average number of heap allocations
+ * made by the measured code, including destruction of the created object.
  */
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+/// number of heap allocations made by the process
+static std::atomic<size_t> allocations{0};
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (auto *ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
 
 /// number of commands in a single transaction
 constexpr int number_of_commands = 5;
 
-/// number of transactions in a single block
+/// default number of transactions in a single block, benchmarks take the
+/// number as an argument
 constexpr int number_of_txs = 100;
 
+/// number of transactions in large blocks and proposals
+constexpr int large_number_of_txs = 10000;
+
 class BlockBenchmark : public benchmark::Fixture {
  public:
   // Block cannot be copy-assigned, that's why the state is kept in a builder
@@ -50,7 +84,7 @@ class BlockBenchmark : public benchmark::Fixture {
 
     std::vector<shared_model::proto::Transaction> txs;
 
-    for (int i = 0; i < number_of_txs; i++) {
+    for (int i = 0; i < st.range(0); i++) {
       txs.push_back(base_tx.build());
     }
 
@@ -76,7 +110,7 @@ class ProposalBenchmark : public benchmark::Fixture {
 
     std::vector<shared_model::proto::Transaction> txs;
 
-    for (int i = 0; i < number_of_txs; i++) {
+    for (int i = 0; i < st.range(0); i++) {
       txs.push_back(base_tx.build());
     }
 
@@ -98,19 +132,30 @@ void checkLoop(const T &obj) {
 }
 
 /**
- * Runs a function and updates timer of the given state
+ * Runs a function and updates timer and allocations counter of the given state
  */
 template <typename Func>
 void runBenchmark(benchmark::State &st, Func &&f) {
+  auto allocations_before = allocations.load();
   auto start = std::chrono::high_resolution_clock::now();
   f();
   auto end   = std::chrono::high_resolution_clock::now();
+  auto allocations_after = allocations.load();
 
   auto elapsed_seconds =
       std::chrono::duration_cast<std::chrono::duration<double>>(
           end - start);
 
   st.SetIterationTime(elapsed_seconds.count());
+  st.counters["allocations"].value += allocations_after - allocations_before;
+}
+
+/**
+ * Turns the total number of allocations counted by runBenchmark into the
+ * number of allocations per iteration
+ */
+void reportAllocations(benchmark::State &st) {
+  st.counters["allocations"].value /= st.iterations();
 }
 
 /**
@@ -125,6 +170,7 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportCopyTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -133,13 +179,14 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportCopyTest)(benchmark::State &st) {
 BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveTest)(benchmark::State &st) {
   while (st.KeepRunning()) {
     auto block = complete_builder.build();
-    iroha::protocol::Block proto_block = block.getTransport();
+    iroha::protocol::Block_v1 proto_block = block.getTransport();
 
     runBenchmark(st, [&proto_block] {
       shared_model::proto::Block copy(std::move(proto_block));
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -154,6 +201,7 @@ BENCHMARK_DEFINE_F(BlockBenchmark, MoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -168,6 +216,23 @@ BENCHMARK_DEFINE_F(BlockBenchmark, CloneTest)(benchmark::State &st) {
       checkLoop(*copy);
     });
   }
+  reportAllocations(st);
+}
+
+/**
+ * Benchmark block construction from protobuf object without access to
+ * transaction fields
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, ConstructionTest)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto block = complete_builder.build();
+
+    runBenchmark(st, [&block] {
+      shared_model::proto::Block copy(block.getTransport());
+      benchmark::DoNotOptimize(copy.transactions());
+    });
+  }
+  reportAllocations(st);
 }
 
 /**
@@ -182,6 +247,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, TransportCopyTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -197,6 +263,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, TransportMoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -211,6 +278,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  reportAllocations(st);
 }
 
 /**
@@ -225,15 +293,108 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, CloneTest)(benchmark::State &st) {
       checkLoop(*copy);
     });
   }
+  reportAllocations(st);
+}
+
+/**
+ * Benchmark proposal construction from protobuf object without access to
+ * transaction fields
+ */
+BENCHMARK_DEFINE_F(ProposalBenchmark, ConstructionTest)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto proposal = complete_builder.build();
+
+    runBenchmark(st, [&proposal] {
+      shared_model::proto::Proposal copy(proposal.getTransport());
+      benchmark::DoNotOptimize(copy.transactions());
+    });
+  }
+  reportAllocations(st);
+}
+
+/**
+ * Benchmark block creation by the factory from transactions of another block
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, FactoryTest)(benchmark::State &st) {
+  shared_model::proto::ProtoBlockFactory factory(nullptr, nullptr);
+  std::vector<shared_model::crypto::Hash> rejected_hashes;
+
+  while (st.KeepRunning()) {
+    auto block = complete_builder.build();
+
+    runBenchmark(st, [&] {
+      auto copy = factory.unsafeCreateBlock(block.height(),
+                                            block.prevHash(),
+                                            block.createdTime(),
+                                            block.transactions(),
+                                            rejected_hashes);
+      checkLoop(*copy);
+    });
+  }
+  reportAllocations(st);
+}
+
+/**
+ * Benchmark proposal creation by the factory from transactions of another
+ * proposal
+ */
+BENCHMARK_DEFINE_F(ProposalBenchmark, FactoryTest)(benchmark::State &st) {
+  shared_model::proto::ProtoProposalFactory<
+      shared_model::validation::AlwaysValidValidator>
+      factory;
+
+  while (st.KeepRunning()) {
+    auto proposal = complete_builder.build();
+
+    runBenchmark(st, [&] {
+      auto copy = factory.unsafeCreateProposal(
+          proposal.height(), proposal.createdTime(), proposal.transactions());
+      checkLoop(*copy);
+    });
+  }
+  reportAllocations(st);
 }
 
-BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
-BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
-BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
-BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
-BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
-BENCHMARK_REGISTER_F(ProposalBenchmark, CloneTest)->UseManualTime();
-BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
-BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, CloneTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)
+    ->Arg(number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, FactoryTest)
+    ->Arg(number_of_txs)
+    ->Arg(large_number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, FactoryTest)
+    ->Arg(number_of_txs)
+    ->Arg(large_number_of_txs)
+    ->UseManualTime();
+
+BENCHMARK_REGISTER_F(BlockBenchmark, ConstructionTest)
+    ->Arg(number_of_txs)
+    ->Arg(large_number_of_txs)
+    ->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, ConstructionTest)
+    ->Arg(number_of_txs)
+    ->Arg(large_number_of_txs)
+    ->UseManualTime();
 
 BENCHMARK_MAIN();
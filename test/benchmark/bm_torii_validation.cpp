@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Measures parsing and stateless validation of a list of 1000 signed
+ * transactions as received by Torii, with the number of validation threads
+ * given by the argument. Items processed are transactions.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "torii/impl/stateless_validation_pool.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/protobuf/proto_transaction_validator.hpp"
+
+/// number of transactions in the list
+constexpr size_t list_size = 1000;
+
+class ToriiValidationBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &) override {
+    auto now = iroha::time::now();
+    for (size_t i = 0; i < list_size; ++i) {
+      *request.add_transactions() =
+          shared_model::proto::TransactionBuilder()
+              .creatorAccountId("admin@bench")
+              .createdTime(now + i)
+              .quorum(1)
+              .transferAsset(
+                  "admin@bench", "user@bench", "coin#bench", "", "0.01")
+              .build()
+              .signAndAddSignature(key)
+              .finish()
+              .getTransport();
+    }
+  }
+
+  void TearDown(benchmark::State &) override {
+    request.Clear();
+  }
+
+  shared_model::crypto::Keypair key =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  iroha::protocol::TxList request;
+  std::shared_ptr<torii::StatelessValidationPool::TransportFactoryType>
+      factory = std::make_shared<shared_model::proto::ProtoTransportFactory<
+          shared_model::interface::Transaction,
+          shared_model::proto::Transaction>>(
+          std::make_unique<shared_model::validation::
+                               DefaultOptionalSignedTransactionValidator>(),
+          std::make_unique<
+              shared_model::validation::ProtoTransactionValidator>());
+};
+
+BENCHMARK_DEFINE_F(ToriiValidationBenchmark, ListTorii)
+(benchmark::State &st) {
+  torii::StatelessValidationPool pool(factory, st.range(0));
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(pool.build(request.transactions()));
+  }
+  st.SetItemsProcessed(st.iterations() * list_size);
+}
+
+BENCHMARK_REGISTER_F(ToriiValidationBenchmark, ListTorii)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
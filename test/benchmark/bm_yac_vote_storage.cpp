@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Measures the cost of a vote stored in YAC vote storage after the number of
+ * committed rounds given by the argument. Every round collects votes of all
+ * peers, outdated rounds are removed from the storage, so the cost per vote
+ * should not depend on the number of rounds passed.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/common_objects/signature.hpp"
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+/// number of peers voting in each round
+constexpr PeersNumberType kPeers = 4;
+
+/**
+ * Create signatures of peers with distinct public keys
+ */
+std::vector<std::shared_ptr<shared_model::interface::Signature>>
+peerSignatures() {
+  std::vector<std::shared_ptr<shared_model::interface::Signature>> signatures;
+  for (PeersNumberType i = 0; i < kPeers; ++i) {
+    iroha::protocol::Signature signature;
+    // keys are stored as hex strings
+    signature.set_public_key("0" + std::to_string(i));
+    signature.set_signature("00");
+    signatures.push_back(
+        std::make_shared<shared_model::proto::Signature>(std::move(signature)));
+  }
+  return signatures;
+}
+
+static void BM_StoreVote(benchmark::State &state) {
+  // storages log every vote, which would dominate the measurement
+  spdlog::set_level(spdlog::level::off);
+
+  auto signatures = peerSignatures();
+  YacVoteStorage storage;
+  BlockRoundType block_round = 1;
+  auto commit_round = [&] {
+    YacHash hash(Round{block_round++, 0}, "proposal", "block");
+    for (const auto &signature : signatures) {
+      VoteMessage vote;
+      vote.hash = hash;
+      vote.signature = signature;
+      benchmark::DoNotOptimize(storage.store({vote}, kPeers));
+    }
+  };
+
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    commit_round();
+  }
+
+  while (state.KeepRunning()) {
+    commit_round();
+  }
+  state.SetItemsProcessed(state.iterations() * kPeers);
+}
+
+BENCHMARK(BM_StoreVote)
+    ->Arg(0)
+    ->Arg(1000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -21,7 +21,8 @@ namespace iroha {
     void SetUp() override {
       ametsuchi::AmetsuchiTest::SetUp();
       validator = std::make_shared<validation::ChainValidatorImpl>(
-          std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
+          std::make_shared<consensus::yac::SupermajorityCheckerImpl>(),
+          std::make_shared<shared_model::crypto::CryptoVerifierPool<>>(2));
 
       for (size_t i = 0; i < 5; ++i) {
         keys.push_back(shared_model::crypto::DefaultCryptoAlgorithmType::
@@ -141,25 +141,26 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
     PRIMARY KEY (permittee_account_id, account_id, permission_id)
 );
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
-    height text,
-    index text
+    hash varchar NOT NULL,
+    height bigint NOT NULL,
+    index bigint NOT NULL,
+    PRIMARY KEY (hash)
 );
-
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
-    status boolean
+    hash varchar NOT NULL,
+    status boolean NOT NULL,
+    PRIMARY KEY (hash)
 );
-
 CREATE TABLE IF NOT EXISTS height_by_account_set (
-    account_id text,
-    height text
+    account_id text NOT NULL,
+    height bigint NOT NULL,
+    PRIMARY KEY (account_id, height)
 );
 CREATE TABLE IF NOT EXISTS index_by_creator_height (
-    id serial,
-    creator_id text,
-    height text,
-    index text
+    creator_id text NOT NULL,
+    height bigint NOT NULL,
+    index bigint NOT NULL,
+    PRIMARY KEY (creator_id, height, index)
 );
 CREATE TABLE IF NOT EXISTS index_by_id_height_asset (
     id text,
@@ -179,6 +179,10 @@ namespace iroha {
       MOCK_METHOD1(apply,
                    expected::Result<void, validation::CommandError>(
                        const shared_model::interface::Transaction &));
+      MOCK_METHOD1(applyValidated,
+                   expected::Result<void, std::string>(
+                       const std::vector<std::reference_wrapper<
+                           const shared_model::interface::Transaction>> &));
       MOCK_METHOD1(
           createSavepoint,
           std::unique_ptr<TemporaryWsv::SavepointWrapper>(const std::string &));
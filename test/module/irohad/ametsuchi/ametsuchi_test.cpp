@@ -390,6 +390,62 @@ shared_model::proto::Block getBlock() {
   return block;
 }
 
+/**
+ * @given storage with an account
+ * @when signatories of the account are loaded after the block which adds a
+ * signatory is stored, but before its state is committed
+ * @then signatories loaded after the commit include the added one
+ */
+TEST_F(AmetsuchiTest, SignatoriesLoadedDuringCommitNotCached) {
+  shared_model::crypto::PublicKey pubkey1(std::string(32, '1'));
+  shared_model::crypto::PublicKey pubkey2(std::string(32, '2'));
+  auto user_id = "userone@domain";
+
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("adminone")
+                    .createRole("user", {Role::kAddSignatory})
+                    .createDomain("domain", "user")
+                    .createAccount("userone", "domain", pubkey1)
+                    .build());
+  auto block1 = TestBlockBuilder()
+                    .transactions(txs)
+                    .height(1)
+                    .prevHash(fake_hash)
+                    .build();
+  apply(storage, block1);
+
+  txs.clear();
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId(user_id)
+                    .addSignatory(user_id, pubkey2)
+                    .build());
+  auto block2 = TestBlockBuilder()
+                    .transactions(txs)
+                    .height(2)
+                    .prevHash(block1.hash())
+                    .build();
+
+  // blocks are published before the state is committed
+  boost::optional<size_t> loaded_during_commit;
+  auto subscription = storage->on_commit().subscribe([&](const auto &block) {
+    if (block->height() == 2) {
+      auto signatories = storage->getWsvQuery()->getSignatories(user_id);
+      if (signatories) {
+        loaded_during_commit = signatories->size();
+      }
+    }
+  });
+  apply(storage, block2);
+  subscription.unsubscribe();
+  ASSERT_TRUE(loaded_during_commit);
+  ASSERT_EQ(*loaded_during_commit, 1);
+
+  auto signatories = storage->getWsvQuery()->getSignatories(user_id);
+  ASSERT_TRUE(signatories);
+  ASSERT_EQ(signatories->size(), 2);
+}
+
 TEST_F(AmetsuchiTest, TestingStorageWhenInsertBlock) {
   auto log = logger::testLog("TestStorage");
   log->info(
@@ -751,3 +807,100 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
   validateAccountAsset(
       storage->getWsvQuery(), "admin@test", "coin#test", resultingBalance);
 }
+
+/**
+ * @given Storage with prepared state
+ * @when block with other transactions is committed through prepared state
+ * @then commitPrepared fails @and prepared state is not applied
+ */
+TEST_F(PreparedBlockTest, CommitPreparedFailsForDifferentBlock) {
+  auto other_tx = createAddAsset("10.00");
+
+  auto block = createBlock({other_tx});
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_FALSE(framework::expected::err(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  auto commited = storage->commitPrepared(block);
+
+  ASSERT_FALSE(commited);
+
+  validateAccountAsset(
+      storage->getWsvQuery(), "admin@test", "coin#test", base_balance);
+}
+
+/**
+ * @given Storage with prepared state
+ * @when another temporary wsv is created and the same transaction is applied
+ * to it, as in validation of the next proposal after a reject
+ * @then the transaction is applied without waiting for the prepared state
+ * @and the prepared state is dropped
+ */
+TEST_F(PreparedBlockTest, PreparedStateDroppedByNewValidation) {
+  auto block = createBlock({*initial_tx});
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_FALSE(framework::expected::err(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  auto next_wsv =
+      std::move(framework::expected::val(storage->createTemporaryWsv())->value);
+  result = next_wsv->apply(*initial_tx);
+  ASSERT_FALSE(framework::expected::err(result));
+  next_wsv.reset();
+
+  ASSERT_FALSE(storage->commitPrepared(block));
+  validateAccountAsset(
+      storage->getWsvQuery(), "admin@test", "coin#test", base_balance);
+}
+
+class BatchedCommandsTest : public PreparedBlockTest {
+ public:
+  void SetUp() override {
+    storage->setCommandBatching(true);
+    PreparedBlockTest::SetUp();
+  }
+
+  void TearDown() override {
+    storage->setCommandBatching(false);
+    PreparedBlockTest::TearDown();
+  }
+};
+
+/**
+ * @given TemporaryWSV which sends commands of a transaction in one batch
+ * @when valid transactions are applied around a transaction whose second
+ * command fails
+ * @then the error points to the failed command @and only valid transactions
+ * are in the committed state
+ */
+TEST_F(BatchedCommandsTest, FailedCommandRollsBackTransaction) {
+  auto invalid_tx = shared_model::proto::TransactionBuilder()
+                        .creatorAccountId("admin@test")
+                        .createdTime(iroha::time::now())
+                        .quorum(1)
+                        .addAssetQuantity("coin#test", "1.00")
+                        .transferAsset("admin@test",
+                                       "nobody@test",
+                                       "coin#test",
+                                       "",
+                                       "1.00")
+                        .build()
+                        .signAndAddSignature(key)
+                        .finish();
+  auto other_tx = createAddAsset("10.00");
+
+  ASSERT_TRUE(framework::expected::val(temp_wsv->apply(*initial_tx)));
+  auto error = framework::expected::err(temp_wsv->apply(invalid_tx));
+  ASSERT_TRUE(error);
+  ASSERT_EQ(error->error.index, 1);
+  ASSERT_TRUE(framework::expected::val(temp_wsv->apply(other_tx)));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  ASSERT_TRUE(storage->commitPrepared(createBlock({*initial_tx, other_tx})));
+  validateAccountAsset(storage->getWsvQuery(),
+                       "admin@test",
+                       "coin#test",
+                       shared_model::interface::Amount{"20.00"});
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_file_format.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace framework::expected;
+
+class BlockFileFormatTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.push_back(TestTransactionBuilder().creatorAccountId("user@test").build());
+    block = std::make_unique<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .height(1)
+            .transactions(txs)
+            .prevHash(shared_model::crypto::Hash(std::string(32, '0')))
+            .build());
+  }
+
+  std::shared_ptr<shared_model::proto::ProtoBlockJsonConverter> converter =
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
+  BlockFileFormat format{converter};
+  std::unique_ptr<shared_model::proto::Block> block;
+};
+
+/**
+ * @given a block
+ * @when it is serialized and deserialized back
+ * @then the record has binary header and the restored block is equal
+ */
+TEST_F(BlockFileFormatTest, RoundTrip) {
+  auto record = val(format.serialize(*block));
+  ASSERT_TRUE(record);
+  ASSERT_TRUE(BlockFileFormat::isBinary(record->value.data(),
+                                        record->value.size()));
+
+  auto restored = val(format.deserialize(record->value));
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(*restored->value, *block);
+}
+
+/**
+ * @given a block serialized with the legacy json converter
+ * @when it is deserialized
+ * @then the json fallback restores the same block
+ */
+TEST_F(BlockFileFormatTest, LegacyJson) {
+  auto json = val(converter->serialize(*block));
+  ASSERT_TRUE(json);
+  auto record = iroha::stringToBytes(json->value);
+  ASSERT_FALSE(BlockFileFormat::isBinary(record.data(), record.size()));
+
+  auto restored = val(format.deserialize(record));
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(*restored->value, *block);
+}
+
+/**
+ * @given a binary record with a corrupted payload byte
+ * @when it is deserialized
+ * @then checksum mismatch is reported
+ */
+TEST_F(BlockFileFormatTest, CorruptedPayload) {
+  auto record = val(format.serialize(*block));
+  ASSERT_TRUE(record);
+  record->value.back() ^= 0xFF;
+
+  ASSERT_TRUE(err(format.deserialize(record->value)));
+}
+
+/**
+ * @given a binary record with the last bytes cut off
+ * @when it is deserialized
+ * @then size mismatch is reported
+ */
+TEST_F(BlockFileFormatTest, TruncatedRecord) {
+  auto record = val(format.serialize(*block));
+  ASSERT_TRUE(record);
+  record->value.resize(record->value.size() - 1);
+
+  ASSERT_TRUE(err(format.deserialize(record->value)));
+}
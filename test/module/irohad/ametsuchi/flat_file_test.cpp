@@ -142,6 +142,25 @@ TEST_F(BlStore_Test, GetNonExistingFile) {
   ASSERT_FALSE(res);
 }
 
+/**
+ * @given block store with one entry
+ * @when getView() is called for existing and non-existing ids
+ * @then view contains the same data as get(), missing id yields none
+ */
+TEST_F(BlStore_Test, GetView) {
+  auto store = FlatFile::create(block_store_path);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_TRUE(bl_store->add(1u, block));
+
+  auto view = bl_store->getView(1u);
+  ASSERT_TRUE(view);
+  ASSERT_EQ(std::vector<uint8_t>((*view)->data(),
+                                 (*view)->data() + (*view)->size()),
+            block);
+  ASSERT_FALSE(bl_store->getView(2u));
+}
+
 /**
  * @given empty folder with block store
  * @when FlatFile was created
@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/in_memory_balance_executor.hpp"
+
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+#include "module/shared_model/mock_objects_factories/mock_command_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using namespace framework::expected;
+
+    class InMemoryBalanceExecutorTest : public AmetsuchiTest {
+     public:
+      void SetUp() override {
+        AmetsuchiTest::SetUp();
+        sql = std::make_unique<soci::session>(soci::postgresql, pgopt_);
+
+        auto factory =
+            std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+                shared_model::validation::FieldValidator>>();
+        query = std::make_unique<PostgresWsvQuery>(*sql, factory);
+        PostgresCommandExecutor::prepareStatements(*sql);
+        executor = std::make_unique<InMemoryBalanceExecutor>(
+            *sql,
+            std::make_unique<PostgresCommandExecutor>(*sql, perm_converter),
+            std::unordered_set<shared_model::interface::types::AssetIdType>{
+                asset_id});
+
+        *sql << init_;
+
+        shared_model::interface::RolePermissionSet permissions;
+        permissions.set();
+        ASSERT_TRUE(val(execute(
+            *mock_command_factory->constructCreateRole(role, permissions),
+            false)));
+        ASSERT_TRUE(val(execute(
+            *mock_command_factory->constructCreateDomain(domain_id, role),
+            false)));
+        ASSERT_TRUE(val(execute(
+            *mock_command_factory->constructCreateAccount(
+                "id", domain_id, pubkey),
+            false)));
+        ASSERT_TRUE(val(execute(
+            *mock_command_factory->constructCreateAccount(
+                "id2", domain_id, pubkey),
+            false)));
+        ASSERT_TRUE(val(execute(
+            *mock_command_factory->constructCreateAsset("coin", domain_id, 1),
+            false)));
+      }
+
+      void TearDown() override {
+        executor.reset();
+        sql->close();
+        AmetsuchiTest::TearDown();
+      }
+
+      /**
+       * Execute a given command on behalf of account_id
+       * @param do_validation - if the command should be validated
+       * @return result of command execution
+       */
+      template <typename CommandType>
+      CommandResult execute(CommandType &&command, bool do_validation = true) {
+        executor->doValidation(do_validation);
+        executor->setCreatorAccountId(account_id);
+        return executor->operator()(std::forward<CommandType>(command));
+      }
+
+      /**
+       * @return balance of the account stored in the database, empty if
+       * there is no such balance
+       */
+      std::string balance(
+          const shared_model::interface::types::AccountIdType &account) {
+        auto account_asset = query->getAccountAsset(account, asset_id);
+        return account_asset ? account_asset.get()->balance().toStringRepr()
+                             : std::string{};
+      }
+
+      const std::string role = "role";
+      const shared_model::interface::types::DomainIdType domain_id = "domain";
+      const shared_model::interface::types::AccountIdType account_id =
+          "id@domain";
+      const shared_model::interface::types::AccountIdType account2_id =
+          "id2@domain";
+      const shared_model::interface::types::AssetIdType asset_id =
+          "coin#domain";
+      const shared_model::interface::types::PubkeyType pubkey{
+          std::string('1', 32)};
+      const shared_model::interface::Amount one{"1.0"};
+      const shared_model::interface::Amount two{"2.0"};
+
+      std::unique_ptr<soci::session> sql;
+      std::unique_ptr<WsvQuery> query;
+      std::unique_ptr<InMemoryBalanceExecutor> executor;
+
+      std::shared_ptr<shared_model::interface::PermissionToString>
+          perm_converter =
+              std::make_shared<shared_model::proto::ProtoPermissionToString>();
+      std::unique_ptr<shared_model::interface::MockCommandFactory>
+          mock_command_factory =
+              std::make_unique<shared_model::interface::MockCommandFactory>();
+    };
+
+    /**
+     * @given hot asset
+     * @when its quantity is added and transferred
+     * @then the database is not changed until flush, after which it contains
+     * resulting balances
+     */
+    TEST_F(InMemoryBalanceExecutorTest, TransferIsWrittenOnFlush) {
+      ASSERT_TRUE(val(execute(
+          *mock_command_factory->constructAddAssetQuantity(asset_id, two))));
+      ASSERT_TRUE(val(execute(*mock_command_factory->constructTransferAsset(
+          account_id, account2_id, asset_id, "desc", one))));
+      ASSERT_EQ(balance(account_id), "");
+
+      ASSERT_TRUE(val(executor->flush()));
+      ASSERT_EQ(balance(account_id), "1.0");
+      ASSERT_EQ(balance(account2_id), "1.0");
+    }
+
+    /**
+     * @given hot asset with some balance
+     * @when transfer is rolled back to a savepoint
+     * @then flushed balances do not contain the transfer
+     */
+    TEST_F(InMemoryBalanceExecutorTest, RollbackRestoresBalances) {
+      ASSERT_TRUE(val(execute(
+          *mock_command_factory->constructAddAssetQuantity(asset_id, two))));
+      auto mark = executor->savepoint();
+      ASSERT_TRUE(val(execute(*mock_command_factory->constructTransferAsset(
+          account_id, account2_id, asset_id, "desc", one))));
+      executor->rollback(mark);
+
+      ASSERT_TRUE(val(executor->flush()));
+      ASSERT_EQ(balance(account_id), "2.0");
+      ASSERT_EQ(balance(account2_id), "");
+    }
+
+    /**
+     * @given hot asset with some balance
+     * @when more than the balance is transferred
+     * @then the command fails with the code of the postgres executor
+     */
+    TEST_F(InMemoryBalanceExecutorTest, InsufficientBalance) {
+      ASSERT_TRUE(val(execute(
+          *mock_command_factory->constructAddAssetQuantity(asset_id, one))));
+      auto error = err(execute(*mock_command_factory->constructTransferAsset(
+          account_id, account2_id, asset_id, "desc", two)));
+      ASSERT_TRUE(error);
+      ASSERT_EQ(error->error.error_code, 6);
+    }
+
+    /**
+     * @given hot asset balance changed in memory
+     * @when SubtractAssetQuantity is executed by the wrapped executor
+     * @then it sees the changed balance
+     */
+    TEST_F(InMemoryBalanceExecutorTest, DelegatedCommandSeesBalance) {
+      ASSERT_TRUE(val(execute(
+          *mock_command_factory->constructAddAssetQuantity(asset_id, two))));
+      ASSERT_TRUE(val(execute(
+          *mock_command_factory->constructSubtractAssetQuantity(asset_id,
+                                                                one))));
+      ASSERT_TRUE(val(executor->flush()));
+      ASSERT_EQ(balance(account_id), "1.0");
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
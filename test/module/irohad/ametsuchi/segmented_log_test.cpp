@@ -0,0 +1,164 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class SegmentedLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<SegmentedLog> createStore() {
+    auto store = SegmentedLog::create(block_store_path, segment_size, 1);
+    EXPECT_TRUE(store);
+    return std::move(*store);
+  }
+
+  /**
+   * Create a distinct record for the given id
+   */
+  static SegmentedLog::Bytes record(SegmentedLog::Identifier id) {
+    return SegmentedLog::Bytes(100 + id, static_cast<uint8_t>(id));
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  /// small enough to produce several segments
+  uint64_t segment_size = 512;
+};
+
+/**
+ * @given empty storage
+ * @when records are added across several segments and storage is reopened
+ * @then all records are readable and last id is preserved
+ */
+TEST_F(SegmentedLogTest, ReadWriteAcrossSegments) {
+  const SegmentedLog::Identifier count = 10;
+  {
+    auto store = createStore();
+    for (SegmentedLog::Identifier id = 1; id <= count; ++id) {
+      ASSERT_TRUE(store->add(id, record(id)));
+    }
+    ASSERT_EQ(*store->get(count), record(count));
+  }
+
+  auto store = createStore();
+  ASSERT_EQ(store->last_id(), count);
+  for (SegmentedLog::Identifier id = 1; id <= count; ++id) {
+    ASSERT_EQ(*store->get(id), record(id));
+  }
+  ASSERT_FALSE(store->get(count + 1));
+  ASSERT_GT(std::distance(fs::directory_iterator(block_store_path),
+                          fs::directory_iterator()),
+            2);
+}
+
+/**
+ * @given storage with records in several segments
+ * @when getView() is called
+ * @then mapped view contains the same data as the record
+ */
+TEST_F(SegmentedLogTest, GetView) {
+  const SegmentedLog::Identifier count = 10;
+  auto store = createStore();
+  for (SegmentedLog::Identifier id = 1; id <= count; ++id) {
+    ASSERT_TRUE(store->add(id, record(id)));
+  }
+
+  for (SegmentedLog::Identifier id = 1; id <= count; ++id) {
+    auto view = store->getView(id);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(SegmentedLog::Bytes((*view)->data(),
+                                  (*view)->data() + (*view)->size()),
+              record(id));
+  }
+  ASSERT_FALSE(store->getView(count + 1));
+}
+
+/**
+ * @given storage with records
+ * @when record is added with non-consecutive id
+ * @then it is rejected
+ */
+TEST_F(SegmentedLogTest, NonConsecutiveAdd) {
+  auto store = createStore();
+  ASSERT_TRUE(store->add(1, record(1)));
+  ASSERT_FALSE(store->add(3, record(3)));
+  ASSERT_FALSE(store->add(1, record(1)));
+  ASSERT_EQ(store->last_id(), 1);
+}
+
+/**
+ * @given storage whose active segment ends with a partially written record
+ * @when storage is reopened
+ * @then the torn record is truncated and new records can be appended
+ */
+TEST_F(SegmentedLogTest, TornTailIsTruncated) {
+  {
+    auto store = createStore();
+    ASSERT_TRUE(store->add(1, record(1)));
+    ASSERT_TRUE(store->add(2, record(2)));
+  }
+
+  const auto segment =
+      fs::path(block_store_path) / SegmentedLog::segment_name(1);
+  const auto full_size = fs::file_size(segment);
+  fs::resize_file(segment, full_size - 10);
+
+  auto store = createStore();
+  ASSERT_EQ(store->last_id(), 1);
+  ASSERT_EQ(*store->get(1), record(1));
+  ASSERT_EQ(fs::file_size(segment),
+            SegmentedLog::kRecordHeaderSize + record(1).size());
+
+  ASSERT_TRUE(store->add(2, record(2)));
+  ASSERT_EQ(*store->get(2), record(2));
+}
+
+/**
+ * @given storage with several segments
+ * @when index file of a sealed segment is removed
+ * @then index is rebuilt by scanning the segment
+ */
+TEST_F(SegmentedLogTest, MissingIndexIsRebuilt) {
+  const SegmentedLog::Identifier count = 10;
+  {
+    auto store = createStore();
+    for (SegmentedLog::Identifier id = 1; id <= count; ++id) {
+      ASSERT_TRUE(store->add(id, record(id)));
+    }
+  }
+  auto index = fs::path(block_store_path) / SegmentedLog::segment_name(1);
+  ASSERT_TRUE(fs::remove(index.replace_extension(".idx")));
+
+  auto store = createStore();
+  ASSERT_EQ(store->last_id(), count);
+  ASSERT_EQ(*store->get(1), record(1));
+  ASSERT_TRUE(fs::exists(index));
+}
+
+/**
+ * @given storage with records
+ * @when dropAll is called
+ * @then storage is empty and accepts records from the first id
+ */
+TEST_F(SegmentedLogTest, DropAll) {
+  auto store = createStore();
+  ASSERT_TRUE(store->add(1, record(1)));
+  store->dropAll();
+  ASSERT_EQ(store->last_id(), 0);
+  ASSERT_FALSE(store->get(1));
+  ASSERT_TRUE(store->add(1, record(1)));
+}
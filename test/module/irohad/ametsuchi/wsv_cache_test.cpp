@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/block.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using Roles = std::vector<shared_model::interface::types::RoleIdType>;
+
+class WsvCacheTest : public ::testing::Test {
+ protected:
+  /**
+   * Create a loader which counts its calls and returns the given roles
+   */
+  auto rolesLoader(Roles roles) {
+    return [this, roles]() -> boost::optional<Roles> {
+      ++loads;
+      return roles;
+    };
+  }
+
+  /**
+   * Request roles of the account, loading the given roles on miss
+   * @return requested roles, empty if there are none
+   */
+  Roles getRoles(Roles loaded) {
+    return cache.getAccountRoles(account_id, rolesLoader(std::move(loaded)))
+        .value_or(Roles{});
+  }
+
+  /**
+   * Create a block with a single transaction built by the given function
+   */
+  template <typename Builder>
+  shared_model::proto::Block makeBlock(Builder &&builder) {
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.push_back(builder(TestTransactionBuilder()
+                              .creatorAccountId("admin@test")
+                              .createdTime(iroha::time::now()))
+                      .build());
+    return TestBlockBuilder().height(2).transactions(txs).build();
+  }
+
+  WsvCache cache;
+  size_t loads = 0;
+  const std::string account_id = "user@test";
+};
+
+/**
+ * @given empty cache
+ * @when the same value is requested twice
+ * @then loader is called once and hit and miss are counted
+ */
+TEST_F(WsvCacheTest, LoadsOnce) {
+  ASSERT_EQ(getRoles({"user"}), Roles{"user"});
+  ASSERT_EQ(getRoles({"admin"}), Roles{"user"});
+  ASSERT_EQ(loads, 1);
+  ASSERT_EQ(cache.hits(), 1);
+  ASSERT_EQ(cache.misses(), 1);
+}
+
+/**
+ * @given empty cache
+ * @when loader returns none
+ * @then nothing is stored and the next request loads again
+ */
+TEST_F(WsvCacheTest, MissingValueIsNotStored) {
+  auto missing = [this]() -> boost::optional<Roles> {
+    ++loads;
+    return boost::none;
+  };
+  ASSERT_FALSE(cache.getAccountRoles(account_id, missing));
+  ASSERT_FALSE(cache.getAccountRoles(account_id, missing));
+  ASSERT_EQ(loads, 2);
+}
+
+/**
+ * @given cached roles of the account
+ * @when block with AppendRole for the account is committed
+ * @then roles are loaded again
+ */
+TEST_F(WsvCacheTest, InvalidatedByBlock) {
+  getRoles({"user"});
+  cache.invalidate(makeBlock([this](auto builder) {
+    return builder.appendRole(account_id, "admin");
+  }));
+
+  ASSERT_EQ(getRoles({"user", "admin"}), (Roles{"user", "admin"}));
+  ASSERT_EQ(loads, 2);
+}
+
+/**
+ * @given cached roles of the account
+ * @when block which does not change the account is committed
+ * @then roles are still served from the cache
+ */
+TEST_F(WsvCacheTest, UnrelatedBlockKeepsEntry) {
+  getRoles({"user"});
+  cache.invalidate(makeBlock([](auto builder) {
+    return builder.setAccountQuorum("other@test", 2);
+  }));
+
+  ASSERT_EQ(getRoles({"admin"}), Roles{"user"});
+  ASSERT_EQ(loads, 1);
+}
+
+/**
+ * @given empty cache
+ * @when a block is committed while the value is being loaded
+ * @then the loaded value is returned but not stored
+ */
+TEST_F(WsvCacheTest, ValueLoadedDuringCommitIsNotStored) {
+  auto block = makeBlock(
+      [this](auto builder) { return builder.appendRole(account_id, "admin"); });
+  auto roles = cache.getAccountRoles(account_id,
+                                     [&]() -> boost::optional<Roles> {
+                                       ++loads;
+                                       cache.invalidate(block);
+                                       return Roles{"user"};
+                                     });
+  ASSERT_TRUE(roles);
+  ASSERT_EQ(*roles, Roles{"user"});
+
+  ASSERT_EQ(getRoles({"user", "admin"}), (Roles{"user", "admin"}));
+  ASSERT_EQ(loads, 2);
+}
@@ -8,10 +8,12 @@
 #include <grpc++/grpc++.h>
 
 #include "consensus/yac/transport/impl/network_impl.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 
 using ::testing::_;
 using ::testing::DoAll;
 using ::testing::InvokeWithoutArgs;
+using ::testing::Return;
 using ::testing::SaveArg;
 
 namespace iroha {
@@ -25,7 +27,10 @@ namespace iroha {
           notifications = std::make_shared<MockYacNetworkNotifications>();
           async_call = std::make_shared<
               network::AsyncGrpcClient<google::protobuf::Empty>>();
-          network = std::make_shared<NetworkImpl>(async_call);
+          peer_query_factory =
+              std::make_shared<ametsuchi::MockPeerQueryFactory>();
+          network = std::make_shared<NetworkImpl>(async_call,
+                                                  peer_query_factory);
 
           message.hash.vote_hashes.proposal_hash = "proposal";
           message.hash.vote_hashes.block_hash = "block";
@@ -46,18 +51,64 @@ namespace iroha {
           ASSERT_NE(port, 0);
 
           peer = mk_peer(std::string(default_ip) + ":" + std::to_string(port));
+
+          YacHash hash(Round{1, 0}, "proposal", "block");
+          for (const auto &key : {"a", "b"}) {
+            auto vote = createVote(hash, key);
+            vote.hash.block_signature = createSig(key);
+            commit.push_back(vote);
+
+            auto ledger_peer = std::make_shared<MockPeer>();
+            EXPECT_CALL(*ledger_peer, pubkey())
+                .WillRepeatedly(::testing::ReturnRefOfCopy(
+                    vote.signature->publicKey()));
+            ledger_peers.push_back(ledger_peer);
+          }
+          auto peer_query = std::make_shared<ametsuchi::MockPeerQuery>();
+          EXPECT_CALL(*peer_query, getLedgerPeers())
+              .WillRepeatedly(Return(ledger_peers));
+          ON_CALL(*peer_query_factory, createPeerQuery())
+              .WillByDefault(Return(boost::make_optional(
+                  std::shared_ptr<ametsuchi::PeerQuery>(peer_query))));
         }
 
         void TearDown() override {
           server->Shutdown();
         }
 
+        /**
+         * Expect the votes to be received, the flag is set when they are
+         * @param notifications - handler of received votes
+         * @param processed - flag of received votes
+         */
+        void expectCommit(MockYacNetworkNotifications &notifications,
+                          bool &processed) {
+          EXPECT_CALL(notifications, onState(commit))
+              .WillOnce(InvokeWithoutArgs([&] {
+                std::lock_guard<std::mutex> lock(mtx);
+                processed = true;
+                cv.notify_all();
+              }));
+        }
+
+        /**
+         * Wait until the flag is set
+         */
+        void wait(bool &processed) {
+          std::unique_lock<std::mutex> lk(mtx);
+          cv.wait(lk, [&] { return processed; });
+        }
+
         std::shared_ptr<MockYacNetworkNotifications> notifications;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call;
+        std::shared_ptr<ametsuchi::MockPeerQueryFactory> peer_query_factory;
         std::shared_ptr<NetworkImpl> network;
         std::shared_ptr<shared_model::interface::Peer> peer;
         VoteMessage message;
+        std::vector<VoteMessage> commit;
+        std::vector<std::shared_ptr<shared_model::interface::Peer>>
+            ledger_peers;
         std::unique_ptr<grpc::Server> server;
         std::mutex mtx;
         std::condition_variable cv;
@@ -90,6 +141,55 @@ namespace iroha {
         ASSERT_EQ(1, state.size());
         ASSERT_EQ(message, state.front());
       }
+
+      /**
+       * @given initialized network with ledger peers
+       * @when votes of a commit are sent to itself
+       * @then they are sent as commit certificate, which is restored with
+       * ledger peers by both sides, and handled as the same votes
+       */
+      TEST_F(YacNetworkTest, CommitSentAsCertificate) {
+        bool processed = false;
+        EXPECT_CALL(*peer_query_factory, createPeerQuery()).Times(2);
+        expectCommit(*notifications, processed);
+
+        network->sendState(*peer, commit);
+        wait(processed);
+      }
+
+      /**
+       * @given initialized network with ledger peers
+       * @when votes of a commit are sent twice to a peer which does not
+       * support commit certificates
+       * @then the votes are resent as state after the certificate is not
+       * accepted, and sent as state right away the next time
+       */
+      TEST_F(YacNetworkTest, CertificateFallsBackToState) {
+        auto legacy_notifications =
+            std::make_shared<MockYacNetworkNotifications>();
+        auto legacy = std::make_shared<NetworkImpl>(async_call);
+        legacy->subscribe(legacy_notifications);
+
+        grpc::ServerBuilder builder;
+        int port = 0;
+        builder.AddListeningPort(
+            default_address, grpc::InsecureServerCredentials(), &port);
+        builder.RegisterService(legacy.get());
+        auto legacy_server = builder.BuildAndStart();
+        ASSERT_TRUE(legacy_server);
+        auto legacy_peer =
+            mk_peer(std::string(default_ip) + ":" + std::to_string(port));
+
+        EXPECT_CALL(*peer_query_factory, createPeerQuery()).Times(1);
+        for (auto i = 0; i < 2; ++i) {
+          bool processed = false;
+          expectCommit(*legacy_notifications, processed);
+          network->sendState(*legacy_peer, commit);
+          wait(processed);
+        }
+
+        legacy_server->Shutdown();
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -86,6 +86,62 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given verified vote
+       * @when the signature of the vote is replaced
+       * @then the vote is verified again and is invalid
+       */
+      TEST_F(YacCryptoProviderTest, InvalidWhenSignatureChangedAfterVerified) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        EXPECT_CALL(*factory, createSignature(keypair.publicKey(), _))
+            .WillOnce(Invoke([this](auto &pubkey, auto &sig) {
+              return expected::makeValue(this->makeSignature(pubkey, sig));
+            }));
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+
+        vote.signature =
+            makeSignature(keypair.publicKey(),
+                          shared_model::crypto::Signed(signed_data));
+
+        ASSERT_FALSE(crypto_provider->verify({vote}));
+      }
+
+      /**
+       * @given crypto provider with verifier pool
+       * @when message with several votes is verified
+       * AND one of the votes is changed after verification
+       * @then the message is valid at first and invalid after the change
+       */
+      TEST_F(YacCryptoProviderTest, VerifierPool) {
+        auto pool =
+            std::make_shared<shared_model::crypto::CryptoVerifierPool<>>(2, 1);
+        crypto_provider =
+            std::make_shared<CryptoProviderImpl>(keypair, factory, pool);
+        EXPECT_CALL(*factory, createSignature(keypair.publicKey(), _))
+            .Times(4)
+            .WillRepeatedly(Invoke([this](auto &pubkey, auto &sig) {
+              return expected::makeValue(this->makeSignature(pubkey, sig));
+            }));
+
+        std::vector<VoteMessage> votes;
+        for (RejectRoundType i = 0; i < 4; ++i) {
+          YacHash hash(Round{1, i}, "1", "1");
+          hash.block_signature = makeSignature();
+          votes.push_back(crypto_provider->getVote(hash));
+        }
+        ASSERT_TRUE(crypto_provider->verify(votes));
+
+        votes.back().hash.vote_hashes.block_hash = "hash changed";
+
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+
+#include <gtest/gtest.h>
+#include "module/irohad/consensus/yac/yac_mocks.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+class YacVoteStorageTest : public ::testing::Test {
+ public:
+  /**
+   * Store votes of all peers for the round one by one
+   * @return answer of the storage to the last vote
+   */
+  boost::optional<Answer> storeVotes(const Round &round) {
+    boost::optional<Answer> answer;
+    YacHash hash(round, "proposal", "block");
+    for (PeersNumberType i = 0; i < number_of_peers; ++i) {
+      answer =
+          storage.store({createVote(hash, std::to_string(i))}, number_of_peers);
+    }
+    return answer;
+  }
+
+  PeersNumberType number_of_peers = 4;
+  YacVoteStorage storage{1};
+};
+
+/**
+ * @given vote storage keeping one block round before the last commit
+ * @when commit is collected for a later round
+ * @then votes of the rounds behind the window are ignored, and those rounds
+ * are considered closed, while rounds in the window are still processed
+ */
+TEST_F(YacVoteStorageTest, OutdatedRoundsRemoved) {
+  YacHash old_hash(Round{1, 0}, "proposal", "block");
+  ASSERT_EQ(boost::none,
+            storage.store({createVote(old_hash, "0")}, number_of_peers));
+
+  auto commit = storeVotes(Round{3, 0});
+  ASSERT_TRUE(commit);
+  ASSERT_NO_THROW(boost::get<CommitMessage>(*commit));
+
+  ASSERT_TRUE(storage.isCommitted(Round{1, 0}));
+  ASSERT_EQ(boost::none, storeVotes(Round{1, 0}));
+
+  ASSERT_FALSE(storage.isCommitted(Round{2, 0}));
+  ASSERT_TRUE(storeVotes(Round{2, 0}));
+  ASSERT_TRUE(storage.isCommitted(Round{2, 0}));
+}
+
+/**
+ * @given vote storage with processing state of a round
+ * @when the round goes behind the window of kept rounds
+ * @then processing state of the round is removed
+ */
+TEST_F(YacVoteStorageTest, OutdatedProcessingStateRemoved) {
+  storage.nextProcessingState(Round{1, 0});
+  storage.nextProcessingState(Round{2, 0});
+  ASSERT_EQ(ProposalState::kSentNotProcessed,
+            storage.getProcessingState(Round{1, 0}));
+
+  storeVotes(Round{3, 0});
+
+  ASSERT_EQ(ProposalState::kNotSentNotProcessed,
+            storage.getProcessingState(Round{1, 0}));
+  ASSERT_EQ(ProposalState::kSentNotProcessed,
+            storage.getProcessingState(Round{2, 0}));
+}
@@ -0,0 +1,184 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <condition_variable>
+#include <future>
+
+#include <gtest/gtest.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/generic/generic_stub.h>
+#include "framework/mock_stream.h"
+
+using namespace iroha::network;
+
+using grpc::testing::MockClientAsyncResponseReader;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::SaveArg;
+
+class AsyncGrpcClientTest : public ::testing::Test {
+ public:
+  using Client = AsyncGrpcClient<google::protobuf::Empty>;
+
+  /**
+   * Start a call, which is completed by completeCall
+   * @return tag of the call in the completion queue
+   */
+  std::future<void *> startCall(Client &client,
+                                Client::OnResponse on_response) {
+    auto tag = std::make_shared<std::promise<void *>>();
+    auto future = tag->get_future();
+    client.Call(
+        [tag](auto context, auto cq) {
+          // owned and deleted by the client
+          auto reader =
+              new MockClientAsyncResponseReader<google::protobuf::Empty>();
+          EXPECT_CALL(*reader, Finish(_, _, _))
+              .WillOnce(Invoke([tag](auto, auto status, auto call_tag) {
+                *status = grpc::Status::OK;
+                tag->set_value(call_tag);
+              }));
+          return std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<
+              google::protobuf::Empty>>(reader);
+        },
+        std::move(on_response));
+    return future;
+  }
+
+  /**
+   * Deliver the response of the started call
+   */
+  void completeCall(Client &client, grpc::Alarm &alarm, void *tag) {
+    alarm.Set(&client.cq_, gpr_now(GPR_CLOCK_REALTIME), tag);
+  }
+};
+
+/**
+ * @given client with limit of one call in flight and a started call
+ * @when another call is performed
+ * @then it is rejected with RESOURCE_EXHAUSTED status without being started
+ * @and the first call is processed after it completes
+ */
+TEST_F(AsyncGrpcClientTest, InFlightCallsBounded) {
+  Client client(Client::Options{1, 1, std::chrono::seconds(10)});
+  std::promise<grpc::Status> first_status;
+  auto tag = startCall(client, [&](const auto &status, const auto &) {
+                first_status.set_value(status);
+              }).get();
+  ASSERT_EQ(1, client.statistics().in_flight);
+
+  auto rejected = false;
+  client.Call(
+      [](auto, auto) {
+        ADD_FAILURE() << "Call is started";
+        return std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<
+            google::protobuf::Empty>>();
+      },
+      [&](const auto &status, const auto &) {
+        rejected = status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED;
+      });
+  ASSERT_TRUE(rejected);
+
+  grpc::Alarm alarm;
+  completeCall(client, alarm, tag);
+  ASSERT_TRUE(first_status.get_future().get().ok());
+
+  auto statistics = client.statistics();
+  ASSERT_EQ(0, statistics.in_flight);
+  ASSERT_EQ(1, statistics.completed);
+  ASSERT_EQ(0, statistics.failed);
+  ASSERT_EQ(1, statistics.rejected);
+}
+
+/**
+ * @given client with two threads
+ * @when two calls complete, and the response of the first one is processed
+ * until the second one is processed
+ * @then responses are processed concurrently
+ */
+TEST_F(AsyncGrpcClientTest, ResponsesProcessedConcurrently) {
+  Client client(Client::Options{2, 10, std::chrono::seconds(10)});
+  std::mutex mutex;
+  std::condition_variable processed_cv;
+  auto processed = 0;
+  auto on_response = [&](const auto &, const auto &) {
+    std::unique_lock<std::mutex> lock(mutex);
+    ++processed;
+    processed_cv.notify_all();
+    processed_cv.wait_for(
+        lock, std::chrono::seconds(5), [&] { return processed == 2; });
+  };
+
+  auto first = startCall(client, on_response).get();
+  auto second = startCall(client, on_response).get();
+  grpc::Alarm first_alarm, second_alarm;
+  completeCall(client, first_alarm, first);
+  completeCall(client, second_alarm, second);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(processed_cv.wait_for(
+      lock, std::chrono::seconds(1), [&] { return processed == 2; }));
+}
+
+/**
+ * @given client with call timeout
+ * @when a call which does not set deadline is performed
+ * @then the call has the deadline of the timeout
+ */
+TEST_F(AsyncGrpcClientTest, DeadlineSet) {
+  std::chrono::seconds timeout(10);
+  Client client(Client::Options{1, 10, timeout});
+  std::chrono::system_clock::time_point deadline;
+  void *tag = nullptr;
+  auto start = std::chrono::system_clock::now();
+  client.Call([&](auto context, auto) {
+    deadline = context->deadline();
+    auto reader = new MockClientAsyncResponseReader<google::protobuf::Empty>();
+    EXPECT_CALL(*reader, Finish(_, _, _)).WillOnce(SaveArg<2>(&tag));
+    return std::unique_ptr<
+        grpc::ClientAsyncResponseReaderInterface<google::protobuf::Empty>>(
+        reader);
+  });
+  grpc::Alarm alarm;
+  completeCall(client, alarm, tag);
+
+  ASSERT_LE(start + timeout, deadline);
+  ASSERT_GE(std::chrono::system_clock::now() + timeout, deadline);
+}
+
+/**
+ * @given client with one thread and a channel to an address without server
+ * @when calls are performed one after another
+ * @then each call fails, and call objects of completed calls, whose readers
+ * are allocated on the arena of the call, are cleared and reused
+ */
+TEST_F(AsyncGrpcClientTest, CallObjectRecycled) {
+  AsyncGrpcClient<grpc::ByteBuffer> client(
+      AsyncGrpcClient<grpc::ByteBuffer>::Options{
+          1, 10, std::chrono::seconds(10)});
+  grpc::GenericStub stub(grpc::CreateChannel(
+      "127.0.0.1:1", grpc::InsecureChannelCredentials()));
+  grpc::ByteBuffer request;
+
+  for (auto i = 0; i < 3; ++i) {
+    std::promise<grpc::Status> status;
+    client.Call(
+        [&](auto context, auto cq) {
+          auto reader =
+              stub.PrepareUnaryCall(context, "/iroha.Test/Call", request, cq);
+          reader->StartCall();
+          return std::unique_ptr<
+              grpc::ClientAsyncResponseReaderInterface<grpc::ByteBuffer>>(
+              reader.release());
+        },
+        [&status](const auto &call_status, const auto &) {
+          status.set_value(call_status);
+        });
+    ASSERT_FALSE(status.get_future().get().ok());
+  }
+  ASSERT_EQ(3, client.statistics().completed);
+}
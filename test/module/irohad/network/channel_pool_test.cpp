@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include <google/protobuf/empty.pb.h>
+#include <gtest/gtest.h>
+
+using namespace iroha::network;
+
+class ChannelPoolTest : public ::testing::Test {
+ public:
+  /**
+   * Complete a call to the peer with the given status
+   */
+  void call(const std::string &address, grpc::Status status) {
+    pool.track<google::protobuf::Empty>(
+        address, [](const auto &, const auto &) {})(status, {});
+  }
+
+  ChannelPool pool;
+  std::string address = "127.0.0.1:50051";
+};
+
+/**
+ * @given channel pool
+ * @when channels to the same and to another address are requested
+ * @then the channel to the same address is reused
+ */
+TEST_F(ChannelPoolTest, ChannelReused) {
+  auto channel = pool.getChannel(address);
+  ASSERT_EQ(channel, pool.getChannel(address));
+  ASSERT_NE(channel, pool.getChannel("127.0.0.1:50052"));
+}
+
+/**
+ * @given channel pool with calls to a peer
+ * @when calls are completed
+ * @then their outcomes are counted in statistics of the peer
+ */
+TEST_F(ChannelPoolTest, CallsCounted) {
+  ASSERT_FALSE(pool.statistics(address));
+
+  call(address, grpc::Status::OK);
+  call(address, grpc::Status::CANCELLED);
+  call(address, grpc::Status::CANCELLED);
+
+  auto statistics = pool.statistics(address);
+  ASSERT_TRUE(statistics);
+  ASSERT_EQ(3, statistics->calls);
+  ASSERT_EQ(2, statistics->failures);
+  ASSERT_EQ(2, statistics->consecutive_failures);
+
+  call(address, grpc::Status::OK);
+  ASSERT_EQ(0, pool.statistics(address)->consecutive_failures);
+}
+
+/**
+ * @given channel pool with channels to two peers
+ * @when one of the peers is not retained
+ * @then its channel and statistics are removed, and a new channel is created
+ * on request
+ */
+TEST_F(ChannelPoolTest, RemovedPeerEvicted) {
+  auto removed = "127.0.0.1:50052";
+  auto channel = pool.getChannel(removed);
+  call(removed, grpc::Status::OK);
+  pool.getChannel(address);
+
+  pool.retain({address});
+
+  ASSERT_TRUE(pool.statistics(address));
+  ASSERT_FALSE(pool.statistics(removed));
+  ASSERT_NE(channel, pool.getChannel(removed));
+}
+
+/**
+ * @given channel pool with channels to two peers and a subscriber to
+ * evictions
+ * @when one of the peers is not retained, and then all peers are retained
+ * @then the subscriber is notified once with the evicted peer
+ */
+TEST_F(ChannelPoolTest, EvictionNotified) {
+  auto removed = "127.0.0.1:50052";
+  pool.getChannel(removed);
+  pool.getChannel(address);
+  std::vector<std::vector<std::string>> evicted;
+  auto subscription = pool.onEvicted().subscribe(
+      [&evicted](const auto &addresses) { evicted.push_back(addresses); });
+
+  pool.retain({address});
+  pool.retain({address});
+  subscription.unsubscribe();
+
+  ASSERT_EQ(1, evicted.size());
+  ASSERT_EQ(std::vector<std::string>{removed}, evicted.front());
+}
@@ -16,9 +16,12 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+using ::testing::_;
 using ::testing::ByMove;
+using ::testing::Invoke;
 using ::testing::Ref;
 using ::testing::Return;
+using ::testing::ReturnRef;
 
 /**
  * Create unique_ptr with MockOdOsNotification, save to var, and return it
@@ -133,3 +136,103 @@ TEST_F(OnDemandConnectionManagerTest, onRequestProposalNone) {
 
   ASSERT_FALSE(result);
 }
+
+/**
+ * @given OnDemandConnectionManager which prefetches proposals
+ * @when onRequestProposal is called
+ * AND proposal of the next reject round is requested
+ * @then proposal of the next reject round is received from the prefetched
+ * request
+ */
+TEST_F(OnDemandConnectionManagerTest, PrefetchedProposal) {
+  OnDemandConnectionManager::RequestOptions options{};
+  options.prefetch = true;
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory, peers.get_observable(), cpeers, options);
+  // prefetched request is used only if the issuer does not change
+  shared_model::interface::types::AddressType address = "127.0.0.1:10001";
+  shared_model::interface::types::PubkeyType key{"key"};
+  for (auto &peer : cpeers.peers) {
+    auto mock_peer = std::static_pointer_cast<MockPeer>(peer);
+    ON_CALL(*mock_peer, address()).WillByDefault(ReturnRef(address));
+    ON_CALL(*mock_peer, pubkey()).WillByDefault(ReturnRef(key));
+  }
+
+  consensus::Round round{1, 0}, next_round{1, 1};
+  auto no_proposal = [](consensus::Round) {
+    return boost::optional<OnDemandConnectionManager::ProposalType>{};
+  };
+  // proposals of other rounds are prefetched as well
+  for (auto type : {OnDemandConnectionManager::kNextRejectRoundIssuer,
+                    OnDemandConnectionManager::kNextCommitRoundIssuer}) {
+    EXPECT_CALL(*connections[type], onRequestProposal(_))
+        .WillRepeatedly(Invoke(no_proposal));
+  }
+  boost::optional<OnDemandConnectionManager::ProposalType> next_proposal =
+      OnDemandConnectionManager::ProposalType{std::make_unique<MockProposal>()};
+  auto proposal = next_proposal.value().get();
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(round))
+      .WillOnce(Invoke(no_proposal));
+  EXPECT_CALL(
+      *connections[OnDemandConnectionManager::kNextRejectRoundIssuer],
+      onRequestProposal(next_round))
+      .WillOnce(Return(ByMove(std::move(next_proposal))));
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(next_round))
+      .Times(0);
+
+  manager->onRequestProposal(round);
+  auto result = manager->onRequestProposal(next_round);
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value().get(), proposal);
+}
+
+/**
+ * @given OnDemandConnectionManager which prefetches proposals
+ * @when prefetched request of the next reject round returns no proposal
+ * AND proposal of the next reject round is requested
+ * @then proposal is requested from the issuer again
+ */
+TEST_F(OnDemandConnectionManagerTest, FailedPrefetchRepeated) {
+  OnDemandConnectionManager::RequestOptions options{};
+  options.prefetch = true;
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory, peers.get_observable(), cpeers, options);
+  shared_model::interface::types::AddressType address = "127.0.0.1:10001";
+  shared_model::interface::types::PubkeyType key{"key"};
+  for (auto &peer : cpeers.peers) {
+    auto mock_peer = std::static_pointer_cast<MockPeer>(peer);
+    ON_CALL(*mock_peer, address()).WillByDefault(ReturnRef(address));
+    ON_CALL(*mock_peer, pubkey()).WillByDefault(ReturnRef(key));
+  }
+
+  consensus::Round round{1, 0}, next_round{1, 1};
+  auto no_proposal = [](consensus::Round) {
+    return boost::optional<OnDemandConnectionManager::ProposalType>{};
+  };
+  // proposals of other rounds are prefetched as well
+  for (auto type : {OnDemandConnectionManager::kNextRejectRoundIssuer,
+                    OnDemandConnectionManager::kNextCommitRoundIssuer}) {
+    EXPECT_CALL(*connections[type], onRequestProposal(_))
+        .WillRepeatedly(Invoke(no_proposal));
+  }
+  boost::optional<OnDemandConnectionManager::ProposalType> next_proposal =
+      OnDemandConnectionManager::ProposalType{};
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(round))
+      .WillOnce(Invoke(no_proposal));
+  EXPECT_CALL(
+      *connections[OnDemandConnectionManager::kNextRejectRoundIssuer],
+      onRequestProposal(next_round))
+      .WillOnce(Invoke(no_proposal));
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(next_round))
+      .WillOnce(Return(ByMove(std::move(next_proposal))));
+
+  manager->onRequestProposal(round);
+  auto result = manager->onRequestProposal(next_round);
+
+  ASSERT_TRUE(result);
+}
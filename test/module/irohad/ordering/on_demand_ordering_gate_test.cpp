@@ -324,3 +324,125 @@ TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
   rounds.get_subscriber().on_next(
       OnDemandOrderingGate::BlockEvent{round, {hash1, hash2}});
 }
+
+/**
+ * @given initialized ordering gate
+ * @when a batch is propagated
+ * AND it is popped from the cache while the ordering services of the rounds
+ * it was sent for still hold it
+ * @then the batch is not sent again
+ */
+TEST_F(OnDemandOrderingGateTest, DeliveredBatchIsNotResent) {
+  auto batch = createMockBatchWithHash(shared_model::crypto::Hash("hash"));
+  cache::OrderingGateCache::BatchesSetType collection{batch};
+
+  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(collection)))
+      .Times(2);
+  EXPECT_CALL(*notification, onBatches(initial_round, _)).Times(1);
+  ordering_gate->propagateBatch(batch);
+
+  EXPECT_CALL(*cache, pop()).WillOnce(Return(collection));
+  EXPECT_CALL(*notification, onBatches(round, _)).Times(0);
+
+  rounds.get_subscriber().on_next(OnDemandOrderingGate::BlockEvent{round, {}});
+}
+
+/**
+ * @given initialized ordering gate
+ * @when a batch is propagated
+ * AND it is popped from the cache after the rounds it was sent for are over
+ * @then the batch is sent again
+ */
+TEST_F(OnDemandOrderingGateTest, ExpiredBatchIsResent) {
+  auto batch = createMockBatchWithHash(shared_model::crypto::Hash("hash"));
+  cache::OrderingGateCache::BatchesSetType collection{batch};
+  consensus::Round expired_round{initial_round.block_round + 3,
+                                 kFirstRejectRound};
+
+  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(collection)))
+      .Times(2);
+  EXPECT_CALL(*notification, onBatches(initial_round, _)).Times(1);
+  ordering_gate->propagateBatch(batch);
+
+  EXPECT_CALL(*cache, pop()).WillOnce(Return(collection));
+  EXPECT_CALL(*notification,
+              onBatches(expired_round, UnorderedElementsAreArray(collection)))
+      .Times(1);
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::BlockEvent{expired_round, {}});
+}
+
+/**
+ * @given initialized ordering gate
+ * @when a batch is propagated
+ * AND only reject rounds follow at the same height
+ * @then the batch is not sent again until the reject round it was sent for
+ * is over, and then it is sent again
+ */
+TEST_F(OnDemandOrderingGateTest, BatchResentAfterRejectRounds) {
+  auto batch = createMockBatchWithHash(shared_model::crypto::Hash("hash"));
+  cache::OrderingGateCache::BatchesSetType collection{batch};
+  auto reject_round = [this](consensus::RejectRoundType reject_round) {
+    return consensus::Round{initial_round.block_round, reject_round};
+  };
+  auto target_round =
+      reject_round(currentRejectRoundConsumer(initial_round.reject_round));
+  auto expired_round = nextRejectRound(target_round);
+
+  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(collection)))
+      .Times(target_round.reject_round - initial_round.reject_round + 2);
+  EXPECT_CALL(*cache, pop()).WillRepeatedly(Return(collection));
+  EXPECT_CALL(*notification, onBatches(initial_round, _)).Times(1);
+  ordering_gate->propagateBatch(batch);
+
+  EXPECT_CALL(*notification, onBatches(_, _)).Times(0);
+  for (auto round = initial_round.reject_round + 1;
+       round <= target_round.reject_round;
+       ++round) {
+    rounds.get_subscriber().on_next(
+        OnDemandOrderingGate::EmptyEvent{reject_round(round)});
+  }
+
+  EXPECT_CALL(*notification,
+              onBatches(expired_round, UnorderedElementsAreArray(collection)))
+      .Times(1);
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::EmptyEvent{expired_round});
+}
+
+/**
+ * @given initialized ordering gate
+ * @when a batch is popped from the cache
+ * AND the proposal of the current round contains the batch
+ * @then the batch is not sent again
+ */
+TEST_F(OnDemandOrderingGateTest, ProposedBatchIsNotResent) {
+  auto tx = std::make_shared<NiceMock<MockTransaction>>();
+  ON_CALL(*tx, hash())
+      .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Hash("tx")));
+  std::vector<decltype(tx)> txs{tx};
+  auto batch = createMockBatchWithTransactions({tx}, "hash");
+  cache::OrderingGateCache::BatchesSetType collection{batch};
+
+  auto proposal = std::make_unique<NiceMock<MockProposal>>();
+  ON_CALL(*proposal, transactions())
+      .WillByDefault(Return(txs | boost::adaptors::indirected));
+  boost::optional<OdOsNotification::ProposalType> arriving_proposal =
+      std::unique_ptr<shared_model::interface::Proposal>(std::move(proposal));
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(arriving_proposal))));
+
+  auto factory_proposal = std::make_unique<NiceMock<MockProposal>>();
+  ON_CALL(*factory_proposal, transactions())
+      .WillByDefault(Return(txs | boost::adaptors::indirected));
+  EXPECT_CALL(*factory, unsafeCreateProposal(_, _, _))
+      .WillOnce(Return(ByMove(std::move(factory_proposal))));
+
+  EXPECT_CALL(*cache, pop()).WillOnce(Return(collection));
+  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(collection)))
+      .Times(1);
+  EXPECT_CALL(*notification, onBatches(_, _)).Times(0);
+
+  rounds.get_subscriber().on_next(OnDemandOrderingGate::BlockEvent{round, {}});
+}
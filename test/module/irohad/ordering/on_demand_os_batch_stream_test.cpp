@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/on_demand_os_batch_stream.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+#include "consensus/round.hpp"
+#include "framework/mock_stream.h"
+#include "ordering_mock.grpc.pb.h"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+using grpc::testing::MockClientReaderWriter;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+class OnDemandOsBatchStreamTest : public ::testing::Test {
+ public:
+  using MockStream =
+      MockClientReaderWriter<proto::BatchesRequest, google::protobuf::Empty>;
+
+  void SetUp() override {
+    auto ustub = std::make_unique<proto::MockOnDemandOrderingStub>();
+    stub = ustub.get();
+    // the window does not end during the test, so requests are sent only
+    // when enough transactions are collected
+    stream = std::make_unique<OnDemandOsBatchStream>(
+        std::move(ustub),
+        OnDemandOsBatchStream::Options{
+            std::chrono::hours(1), 2, std::chrono::hours(1)},
+        [this](proto::BatchesRequest request) {
+          std::lock_guard<std::mutex> lock(fallback_mutex);
+          fallback_requests.push_back(std::move(request));
+          if (fallback_requests.size() == 1) {
+            first_fallback.set_value();
+          }
+        });
+  }
+
+  /**
+   * Expect the stream to be opened, the written request is set to the
+   * returned future
+   * @param write_result - whether the write succeeds
+   * @param status - status of the finished call
+   * @return mock of the opened stream, owned by the batch stream
+   */
+  MockStream *expectStream(bool write_result,
+                           grpc::Status status = grpc::Status::OK) {
+    auto call = new MockStream();
+    EXPECT_CALL(*stub, SendBatchesStreamRaw(_)).WillOnce(Return(call));
+    EXPECT_CALL(*call, Write(_, _))
+        .WillOnce(Invoke([this, write_result](const auto &request, auto) {
+          written.set_value(request);
+          return write_result;
+        }));
+    EXPECT_CALL(*call, Read(_)).Times(write_result ? 1 : 0);
+    ON_CALL(*call, Read(_)).WillByDefault(Return(true));
+    EXPECT_CALL(*call, WritesDone()).WillOnce(Return(true));
+    EXPECT_CALL(*call, Finish()).WillOnce(Return(status));
+    return call;
+  }
+
+  /**
+   * @return request with one transaction of the given creator
+   */
+  proto::BatchesRequest makeRequest(consensus::Round round,
+                                    const std::string &creator) {
+    proto::BatchesRequest request;
+    request.mutable_round()->set_block_round(round.block_round);
+    request.mutable_round()->set_reject_round(round.reject_round);
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id(creator);
+    return request;
+  }
+
+  proto::MockOnDemandOrderingStub *stub;
+  std::unique_ptr<OnDemandOsBatchStream> stream;
+  std::promise<proto::BatchesRequest> written;
+  consensus::Round round{1, 2};
+
+  std::mutex fallback_mutex;
+  std::vector<proto::BatchesRequest> fallback_requests;
+  std::promise<void> first_fallback;
+};
+
+/**
+ * @given batch stream
+ * @when transactions of the same round are sent twice
+ * @then they are written to the stream with one request
+ */
+TEST_F(OnDemandOsBatchStreamTest, SameRoundCoalesced) {
+  expectStream(true);
+
+  stream->send(makeRequest(round, "a@test"));
+  stream->send(makeRequest(round, "b@test"));
+
+  auto request = written.get_future().get();
+  stream.reset();
+
+  ASSERT_EQ(round.block_round, request.round().block_round());
+  ASSERT_EQ(round.reject_round, request.round().reject_round());
+  ASSERT_EQ(2, request.transactions_size());
+  ASSERT_EQ(
+      "a@test",
+      request.transactions(0).payload().reduced_payload().creator_account_id());
+  ASSERT_EQ(
+      "b@test",
+      request.transactions(1).payload().reduced_payload().creator_account_id());
+}
+
+/**
+ * @given batch stream
+ * @when write to the stream fails
+ * @then the stream is closed and opened again for the next transactions
+ */
+TEST_F(OnDemandOsBatchStreamTest, ReopenedAfterFailure) {
+  expectStream(false);
+  stream->send(makeRequest(round, "a@test"));
+  stream->send(makeRequest(round, "b@test"));
+  written.get_future().get();
+
+  written = std::promise<proto::BatchesRequest>();
+  expectStream(true);
+  stream->send(makeRequest(round, "c@test"));
+  stream->send(makeRequest(round, "d@test"));
+  auto request = written.get_future().get();
+  stream.reset();
+
+  ASSERT_EQ(2, request.transactions_size());
+}
+
+/**
+ * @given batch stream
+ * @when the peer responds that it does not implement the stream
+ * @then transactions of the failed request are sent with a separate call
+ * @and further transactions are sent with separate calls without opening
+ * the stream again
+ */
+TEST_F(OnDemandOsBatchStreamTest, UnimplementedFallsBack) {
+  expectStream(false,
+               grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "unimplemented"));
+  stream->send(makeRequest(round, "a@test"));
+  stream->send(makeRequest(round, "b@test"));
+  first_fallback.get_future().get();
+
+  stream->send(makeRequest(round, "c@test"));
+  stream.reset();
+
+  ASSERT_EQ(2, fallback_requests.size());
+  ASSERT_EQ(2, fallback_requests[0].transactions_size());
+  ASSERT_EQ(1, fallback_requests[1].transactions_size());
+  ASSERT_EQ("c@test",
+            fallback_requests[1]
+                .transactions(0)
+                .payload()
+                .reduced_payload()
+                .creator_account_id());
+}
@@ -5,7 +5,10 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <future>
+
 #include <gtest/gtest.h>
+#include <grpcpp/alarm.h>
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
@@ -22,9 +25,16 @@ using namespace iroha::ordering::transport;
 using grpc::testing::MockClientAsyncResponseReader;
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::SaveArg;
-using ::testing::SetArgPointee;
+
+/**
+ * Separate action required because ClientContext is non-copyable
+ */
+ACTION_P(SaveClientContextDeadline, deadline) {
+  *deadline = arg0->deadline();
+}
 
 class OnDemandOsClientGrpcTest : public ::testing::Test {
  public:
@@ -46,6 +56,8 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
     stub = ustub.get();
     async_call =
         std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>();
+    proposal_async_call = std::make_shared<
+        network::AsyncGrpcClient<proto::ProposalResponse>>();
     auto validator = std::make_unique<MockProposalValidator>();
     proposal_validator = validator.get();
     auto proto_validator = std::make_unique<MockProtoProposalValidator>();
@@ -54,13 +66,54 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
         std::move(validator), std::move(proto_validator));
     client = std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
                                                     async_call,
+                                                    proposal_async_call,
                                                     proposal_factory,
                                                     [&] { return timepoint; },
                                                     timeout);
   }
 
+  /**
+   * Expect proposal request with the given response
+   * @param complete - whether the request is completed on the completion
+   * queue of proposal requests at once, otherwise it is done by completeCall
+   */
+  void expectProposalRequest(proto::ProposalResponse response,
+                             bool complete = true) {
+    // owned and deleted by the async client
+    auto reader =
+        new MockClientAsyncResponseReader<proto::ProposalResponse>();
+    EXPECT_CALL(*stub, AsyncRequestProposalRaw(_, _, _))
+        .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
+                        SaveArg<1>(&request),
+                        Return(reader)));
+    EXPECT_CALL(*reader, Finish(_, _, _))
+        .WillOnce(Invoke(
+            [this, response, complete](auto reply, auto status, auto tag) {
+              *reply = response;
+              *status = grpc::Status::OK;
+              call_tag = tag;
+              if (complete) {
+                completeCall();
+              }
+            }));
+  }
+
+  /**
+   * Deliver the response of the expected request
+   */
+  void completeCall() {
+    alarm.Set(
+        &proposal_async_call->cq_, gpr_now(GPR_CLOCK_REALTIME), call_tag);
+  }
+
   proto::MockOnDemandOrderingStub *stub;
   std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>> async_call;
+  std::shared_ptr<network::AsyncGrpcClient<proto::ProposalResponse>>
+      proposal_async_call;
+  grpc::Alarm alarm;
+  void *call_tag = nullptr;
+  std::chrono::system_clock::time_point deadline;
+  proto::ProposalRequest request;
   OnDemandOsClientGrpc::TimepointType timepoint;
   std::chrono::milliseconds timeout{1};
   std::shared_ptr<OnDemandOsClientGrpc> client;
@@ -104,13 +157,6 @@ TEST_F(OnDemandOsClientGrpcTest, onBatches) {
             creator);
 }
 
-/**
- * Separate action required because ClientContext is non-copyable
- */
-ACTION_P(SaveClientContextDeadline, deadline) {
-  *deadline = arg0->deadline();
-}
-
 /**
  * @given client
  * @when onRequestProposal is called
@@ -119,28 +165,23 @@ ACTION_P(SaveClientContextDeadline, deadline) {
  * AND reply is correctly deserialized
  */
 TEST_F(OnDemandOsClientGrpcTest, onRequestProposal) {
-  std::chrono::system_clock::time_point deadline;
-  proto::ProposalRequest request;
   auto creator = "test";
-  proto::ProposalResponse response;
-  response.mutable_proposal()
-      ->add_transactions()
+  protocol::Proposal proposal;
+  proposal.add_transactions()
       ->mutable_payload()
       ->mutable_reduced_payload()
       ->set_creator_account_id(creator);
-  EXPECT_CALL(*stub, RequestProposal(_, _, _))
-      .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
-                      SaveArg<1>(&request),
-                      SetArgPointee<2>(response),
-                      Return(grpc::Status::OK)));
+  proto::ProposalResponse response;
+  response.set_proposal(proposal.SerializeAsString());
+  expectProposalRequest(response);
 
-  auto proposal = client->onRequestProposal(round);
+  auto result = client->onRequestProposal(round);
 
   ASSERT_EQ(timepoint + timeout, deadline);
   ASSERT_EQ(request.round().block_round(), round.block_round);
   ASSERT_EQ(request.round().reject_round(), round.reject_round);
-  ASSERT_TRUE(proposal);
-  ASSERT_EQ(proposal.value()->transactions()[0].creatorAccountId(), creator);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value()->transactions()[0].creatorAccountId(), creator);
 }
 
 /**
@@ -151,14 +192,8 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposal) {
  * AND reply is correctly deserialized
  */
 TEST_F(OnDemandOsClientGrpcTest, onRequestProposalNone) {
-  std::chrono::system_clock::time_point deadline;
-  proto::ProposalRequest request;
   proto::ProposalResponse response;
-  EXPECT_CALL(*stub, RequestProposal(_, _, _))
-      .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
-                      SaveArg<1>(&request),
-                      SetArgPointee<2>(response),
-                      Return(grpc::Status::OK)));
+  expectProposalRequest(response);
 
   auto proposal = client->onRequestProposal(round);
 
@@ -167,3 +202,46 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposalNone) {
   ASSERT_EQ(request.round().reject_round(), round.reject_round);
   ASSERT_FALSE(proposal);
 }
+
+/**
+ * @given client
+ * @when onRequestProposal is called
+ * AND malformed proposal bytes returned
+ * @then no proposal is returned
+ */
+TEST_F(OnDemandOsClientGrpcTest, onRequestProposalMalformed) {
+  proto::ProposalResponse response;
+  response.set_proposal("\xff\xff");
+  expectProposalRequest(response);
+
+  auto proposal = client->onRequestProposal(round);
+
+  ASSERT_FALSE(proposal);
+}
+
+/**
+ * @given client
+ * @when requestProposal is called
+ * AND the client is destroyed before the response is received
+ * @then callback gets the proposal from the response
+ */
+TEST_F(OnDemandOsClientGrpcTest, requestProposalOutlivesClient) {
+  protocol::Proposal proposal;
+  proposal.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("test");
+  proto::ProposalResponse response;
+  response.set_proposal(proposal.SerializeAsString());
+  expectProposalRequest(response, false);
+
+  std::promise<bool> received;
+  client->requestProposal(
+      round, [&received](boost::optional<OdOsNotification::ProposalType> p) {
+        received.set_value(static_cast<bool>(p));
+      });
+  client.reset();
+  completeCall();
+
+  ASSERT_TRUE(received.get_future().get());
+}
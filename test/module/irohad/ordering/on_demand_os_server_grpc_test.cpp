@@ -22,12 +22,28 @@ using namespace iroha::ordering::transport;
 using ::testing::_;
 using ::testing::A;
 using ::testing::ByMove;
+using ::testing::DoAll;
 using ::testing::Invoke;
 using ::testing::Return;
+using ::testing::SetArgPointee;
+
+/**
+ * Server side of batch stream
+ */
+class MockBatchesStream
+    : public grpc::ServerReaderWriterInterface<google::protobuf::Empty,
+                                               proto::BatchesRequest> {
+ public:
+  MOCK_METHOD0(SendInitialMetadata, void());
+  MOCK_METHOD1(NextMessageSize, bool(uint32_t *));
+  MOCK_METHOD1(Read, bool(proto::BatchesRequest *));
+  MOCK_METHOD2(Write,
+               bool(const google::protobuf::Empty &, grpc::WriteOptions));
+};
 
 struct OnDemandOsServerGrpcTest : public ::testing::Test {
   void SetUp() override {
-    notification = std::make_shared<MockOdOsNotification>();
+    notification = std::make_shared<MockOnDemandOrderingService>();
     std::unique_ptr<shared_model::validation::AbstractValidator<
         shared_model::interface::Transaction>>
         interface_transaction_validator =
@@ -53,7 +69,7 @@ struct OnDemandOsServerGrpcTest : public ::testing::Test {
                                                batch_factory);
   }
 
-  std::shared_ptr<MockOdOsNotification> notification;
+  std::shared_ptr<MockOnDemandOrderingService> notification;
   std::shared_ptr<MockTransactionBatchFactory> batch_factory;
   std::shared_ptr<OnDemandOsServerGrpc> server;
   consensus::Round round{1, 2};
@@ -107,6 +123,47 @@ TEST_F(OnDemandOsServerGrpcTest, SendBatches) {
             creator);
 }
 
+/**
+ * @given server
+ * @when batches are received with a stream
+ * @then every request is passed to the ordering service and acknowledged
+ */
+TEST_F(OnDemandOsServerGrpcTest, SendBatchesStream) {
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(2)
+      .WillRepeatedly(Invoke(
+          [](const shared_model::interface::types::SharedTxsCollectionType
+                 &cand)
+              -> shared_model::interface::TransactionBatchFactory::
+                  FactoryResult<std::unique_ptr<
+                      shared_model::interface::TransactionBatch>> {
+                    return iroha::expected::makeValue<std::unique_ptr<
+                        shared_model::interface::TransactionBatch>>(
+                        std::make_unique<
+                            shared_model::interface::TransactionBatchImpl>(
+                            cand));
+                  }));
+  EXPECT_CALL(*notification, onBatches(round, _)).Times(2);
+  proto::BatchesRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("test");
+  MockBatchesStream stream;
+  EXPECT_CALL(stream, Read(_))
+      .WillOnce(DoAll(SetArgPointee<0>(request), Return(true)))
+      .WillOnce(DoAll(SetArgPointee<0>(request), Return(true)))
+      .WillOnce(Return(false));
+  EXPECT_CALL(stream, Write(_, _)).Times(2).WillRepeatedly(Return(true));
+
+  ASSERT_TRUE(server->processBatchesStream(&stream).ok());
+}
+
 /**
  * @given server
  * @when proposal is requested
@@ -125,16 +182,18 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposal) {
       ->mutable_reduced_payload()
       ->set_creator_account_id(creator);
 
-  std::unique_ptr<shared_model::interface::Proposal> iproposal(
-      std::make_unique<shared_model::proto::Proposal>(proposal));
-  EXPECT_CALL(*notification, onRequestProposal(round))
-      .WillOnce(Return(ByMove(std::move(iproposal))));
+  OnDemandOrderingService::ProposalBlobType blob =
+      std::make_shared<shared_model::crypto::Blob>(
+          shared_model::proto::Proposal(proposal).blob());
+  EXPECT_CALL(*notification, onRequestProposalBlob(round))
+      .WillOnce(Return(blob));
 
   server->RequestProposal(nullptr, &request, &response);
 
   ASSERT_TRUE(response.has_proposal());
-  ASSERT_EQ(response.proposal()
-                .transactions()
+  protocol::Proposal received;
+  ASSERT_TRUE(received.ParseFromString(response.proposal()));
+  ASSERT_EQ(received.transactions()
                 .Get(0)
                 .payload()
                 .reduced_payload()
@@ -153,8 +212,8 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposalNone) {
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
   proto::ProposalResponse response;
-  EXPECT_CALL(*notification, onRequestProposal(round))
-      .WillOnce(Return(ByMove(std::move(boost::none))));
+  EXPECT_CALL(*notification, onRequestProposalBlob(round))
+      .WillOnce(Return(boost::none));
 
   server->RequestProposal(nullptr, &request, &response);
 
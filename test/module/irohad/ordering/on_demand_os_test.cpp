@@ -47,6 +47,16 @@ class OnDemandOsTest : public ::testing::Test {
   NiceMock<iroha::ametsuchi::MockTxPresenceCache> *mock_cache;
 
   void SetUp() override {
+    os = createOs(OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverBatches);
+  }
+
+  /**
+   * Create ordering service with FIFO packing policy
+   * @param max_carried_over_batches - number of batches kept for the next
+   * proposal
+   */
+  std::shared_ptr<OnDemandOrderingServiceImpl> createOs(
+      size_t max_carried_over_batches) {
     // TODO: nickaleks IR-1811 use mock factory
     auto factory = std::make_unique<
         shared_model::proto::ProtoProposalFactory<MockProposalValidator>>();
@@ -61,11 +71,14 @@ class OnDemandOsTest : public ::testing::Test {
                 _)))
         .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
             iroha::ametsuchi::tx_cache_status_responses::Missing()}));
-    os = std::make_shared<OnDemandOrderingServiceImpl>(transaction_limit,
-                                                       std::move(factory),
-                                                       std::move(tx_cache),
-                                                       proposal_limit,
-                                                       initial_round);
+    return std::make_shared<OnDemandOrderingServiceImpl>(
+        transaction_limit,
+        std::move(factory),
+        std::move(tx_cache),
+        proposal_limit,
+        initial_round,
+        std::make_shared<FifoPackingPolicy>(),
+        max_carried_over_batches);
   }
 
   /**
@@ -139,6 +152,25 @@ TEST_F(OnDemandOsTest, NormalRound) {
   ASSERT_TRUE(os->onRequestProposal(target_round));
 }
 
+/**
+ * @given initialized on-demand OS
+ * @when  send transactions
+ * AND initiate next round
+ * @then  all requests of the round share one serialized proposal
+ * AND it is the serialization of the proposal
+ */
+TEST_F(OnDemandOsTest, SharedProposalBlob) {
+  generateTransactionsAndInsert(target_round, {1, 2});
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto blob = os->onRequestProposalBlob(target_round);
+  ASSERT_TRUE(blob);
+  ASSERT_EQ(blob->get(), os->onRequestProposalBlob(target_round)->get());
+  ASSERT_EQ(**blob, (*os->onRequestProposal(target_round))->blob());
+  ASSERT_FALSE(os->onRequestProposalBlob(initial_round));
+}
+
 /**
  * @given initialized on-demand OS
  * @when  send number of transactions greater that limit
@@ -156,6 +188,81 @@ TEST_F(OnDemandOsTest, OverflowRound) {
             (*os->onRequestProposal(target_round))->transactions().size());
 }
 
+/**
+ * @given initialized on-demand OS
+ * @when  send number of transactions greater that limit
+ * AND initiate two next rounds
+ * @then  the rest of transactions is carried over to the proposal of the
+ * second round
+ */
+TEST_F(OnDemandOsTest, OverflowRoundCarriedOver) {
+  auto service = createOs(
+      OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverBatches);
+  service->onBatches(target_round,
+                     generateTransactions({1, transaction_limit * 2}));
+
+  service->onCollaborationOutcome(commit_round);
+  service->onCollaborationOutcome(
+      {commit_round.block_round, kNextRejectRoundConsumer});
+
+  auto carried_over_round = consensus::Round{
+      commit_round.block_round,
+      currentRejectRoundConsumer(commit_round.reject_round)};
+  ASSERT_TRUE(service->onRequestProposal(carried_over_round));
+  EXPECT_EQ(
+      transaction_limit - 1,
+      (*service->onRequestProposal(carried_over_round))->transactions().size());
+  EXPECT_EQ(transaction_limit - 1, service->carriedOverBatchesCount());
+  EXPECT_EQ(0, service->droppedBatchesCount());
+}
+
+/**
+ * @given initialized on-demand OS which carries over only a few batches
+ * @when  send number of transactions greater that limit
+ * AND initiate next round
+ * @then  batches which are not carried over are counted as dropped
+ */
+TEST_F(OnDemandOsTest, OverflowRoundDropped) {
+  const size_t max_carried_over = 5;
+  auto service = createOs(max_carried_over);
+  service->onBatches(target_round,
+                     generateTransactions({1, transaction_limit * 2}));
+
+  service->onCollaborationOutcome(commit_round);
+
+  ASSERT_EQ(transaction_limit,
+            (*service->onRequestProposal(target_round))->transactions().size());
+  EXPECT_EQ(max_carried_over, service->carriedOverBatchesCount());
+  EXPECT_EQ(transaction_limit - 1 - max_carried_over,
+            service->droppedBatchesCount());
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when  send a batch with more transactions than the limit
+ * AND initiate next round
+ * @then  the batch is dropped instead of being carried over
+ */
+TEST_F(OnDemandOsTest, OversizedBatchDropped) {
+  auto service =
+      createOs(OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverBatches);
+  shared_model::interface::types::SharedTxsCollectionType transactions;
+  for (const auto &batch : generateTransactions({0, transaction_limit + 1})) {
+    transactions.push_back(batch->transactions().front());
+  }
+  OnDemandOrderingService::CollectionType batches;
+  batches.push_back(
+      std::make_unique<shared_model::interface::TransactionBatchImpl>(
+          std::move(transactions)));
+  service->onBatches(target_round, std::move(batches));
+
+  service->onCollaborationOutcome(commit_round);
+
+  ASSERT_FALSE(service->onRequestProposal(target_round));
+  EXPECT_EQ(0, service->carriedOverBatchesCount());
+  EXPECT_EQ(1, service->droppedBatchesCount());
+}
+
 /**
  * @given initialized on-demand OS
  * @when  send transactions from different threads
@@ -48,6 +48,9 @@ namespace iroha {
                    boost::optional<ProposalType>(consensus::Round));
 
       MOCK_METHOD1(onCollaborationOutcome, void(consensus::Round));
+
+      MOCK_METHOD1(onRequestProposalBlob,
+                   boost::optional<ProposalBlobType>(consensus::Round));
     };
 
   }  // namespace ordering
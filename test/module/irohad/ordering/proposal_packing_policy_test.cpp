@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policy.hpp"
+
+#include <gtest/gtest.h>
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+
+using namespace iroha::ordering;
+
+class ProposalPackingPolicyTest : public ::testing::Test {
+ public:
+  using Candidate = ProposalPackingPolicy::Candidate;
+
+  /**
+   * Create a batch of transactions of the given creator
+   * @param creator - creator account of transactions
+   * @param size - number of transactions in the batch
+   * @param age - number of proposals the batch did not get into
+   */
+  Candidate makeCandidate(const std::string &creator,
+                          size_t size,
+                          size_t age = 0) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      txs.push_back(std::make_shared<shared_model::proto::Transaction>(
+          shared_model::proto::TransactionBuilder()
+              .createdTime(iroha::time::now() + counter_++)
+              .creatorAccountId(creator)
+              .createAsset("asset", "domain", 1)
+              .quorum(1)
+              .build()
+              .signAndAddSignature(
+                  shared_model::crypto::DefaultCryptoAlgorithmType::
+                      generateKeypair())
+              .finish()));
+    }
+    return {std::make_shared<shared_model::interface::TransactionBatchImpl>(
+                std::move(txs)),
+            age};
+  }
+
+ private:
+  size_t counter_ = 0;
+};
+
+/**
+ * @given FIFO policy and batches exceeding the limit
+ * @when  batches are packed
+ * @then  batches are packed in order of arrival, the batch which does not fit
+ * is skipped, the rest keeps the order of arrival
+ */
+TEST_F(ProposalPackingPolicyTest, FifoSkipsBatchWhichDoesNotFit) {
+  auto first = makeCandidate("a@test", 2);
+  auto large = makeCandidate("b@test", 3);
+  auto small = makeCandidate("c@test", 1);
+  auto last = makeCandidate("d@test", 1);
+
+  auto packing = FifoPackingPolicy{}.pack({first, large, small, last}, 4);
+
+  ASSERT_EQ(3, packing.packed.size());
+  EXPECT_EQ(first.batch, packing.packed.at(0));
+  EXPECT_EQ(small.batch, packing.packed.at(1));
+  EXPECT_EQ(last.batch, packing.packed.at(2));
+  ASSERT_EQ(1, packing.rest.size());
+  EXPECT_EQ(large.batch, packing.rest.at(0).batch);
+}
+
+/**
+ * @given priority policy preferring a settlement account
+ * @when  batches of the account arrive last and exceed the limit together
+ * with others
+ * @then  batches of the account are packed first
+ */
+TEST_F(ProposalPackingPolicyTest, PriorityAccountGoesFirst) {
+  PriorityPackingPolicy policy(
+      PriorityPackingPolicy::creatorPriority({{"settlement@test", 1}}), 0);
+  auto regular1 = makeCandidate("a@test", 1);
+  auto regular2 = makeCandidate("b@test", 1);
+  auto settlement = makeCandidate("settlement@test", 1);
+
+  auto packing = policy.pack({regular1, regular2, settlement}, 2);
+
+  ASSERT_EQ(2, packing.packed.size());
+  EXPECT_EQ(settlement.batch, packing.packed.at(0));
+  EXPECT_EQ(regular1.batch, packing.packed.at(1));
+  ASSERT_EQ(1, packing.rest.size());
+  EXPECT_EQ(regular2.batch, packing.rest.at(0).batch);
+}
+
+/**
+ * @given priority policy with equal priorities
+ * @when  batches of different age and size are packed
+ * @then  older batches go first, then smaller ones
+ */
+TEST_F(ProposalPackingPolicyTest, AgeThenSize) {
+  PriorityPackingPolicy policy([](const auto &) { return 0; }, 0);
+  auto large = makeCandidate("a@test", 3);
+  auto small = makeCandidate("b@test", 1);
+  auto old = makeCandidate("c@test", 2, 1);
+
+  auto packing = policy.pack({large, small, old}, 10);
+
+  ASSERT_EQ(3, packing.packed.size());
+  EXPECT_EQ(old.batch, packing.packed.at(0));
+  EXPECT_EQ(small.batch, packing.packed.at(1));
+  EXPECT_EQ(large.batch, packing.packed.at(2));
+  EXPECT_TRUE(packing.rest.empty());
+}
+
+/**
+ * @given priority policy with creator quota
+ * @when  one creator sends more transactions than the quota
+ * @then  transactions of the creator over the quota are left for the next
+ * proposal, while batches of other creators are packed
+ */
+TEST_F(ProposalPackingPolicyTest, CreatorQuota) {
+  PriorityPackingPolicy policy([](const auto &) { return 0; }, 2);
+  auto busy1 = makeCandidate("busy@test", 1);
+  auto busy2 = makeCandidate("busy@test", 1);
+  auto busy3 = makeCandidate("busy@test", 1);
+  auto other = makeCandidate("other@test", 1);
+
+  auto packing = policy.pack({busy1, busy2, busy3, other}, 10);
+
+  ASSERT_EQ(3, packing.packed.size());
+  EXPECT_EQ(busy1.batch, packing.packed.at(0));
+  EXPECT_EQ(busy2.batch, packing.packed.at(1));
+  EXPECT_EQ(other.batch, packing.packed.at(2));
+  ASSERT_EQ(1, packing.rest.size());
+  EXPECT_EQ(busy3.batch, packing.rest.at(0).batch);
+}
@@ -241,6 +241,61 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service with a pool of validation threads
+ * @and list of valid transactions
+ * @when calling ListTorii
+ * @then all transactions are passed to batch factory in order of the list
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiParallel) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  transport_grpc = std::make_shared<torii::CommandServiceTransportGrpc>(
+      command_service,
+      status_bus,
+      status_factory,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      rxcpp::observable<>::iterate(gate_objects),
+      gate_objects.size(),
+      std::make_shared<torii::StatelessValidationPool>(transaction_factory,
+                                                       3));
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kTimes; ++i) {
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_created_time(i);
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  std::vector<shared_model::interface::types::TimestampType> created_times;
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kTimes)
+      .WillRepeatedly(Invoke([&created_times](const auto &txs) {
+        created_times.push_back(txs.front()->createdTime());
+        return iroha::expected::makeError(std::string{"error"});
+      }));
+  EXPECT_CALL(*status_bus, publish(_)).Times(kTimes);
+
+  transport_grpc->ListTorii(&context, &request, &response);
+
+  ASSERT_EQ(created_times,
+            (std::vector<shared_model::interface::types::TimestampType>{
+                0, 1, 2, 3, 4}));
+}
+
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/conflict_analysis.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/transaction.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::validation;
+using Groups = std::vector<std::vector<size_t>>;
+
+class ConflictAnalysisTest : public ::testing::Test {
+ protected:
+  /**
+   * Create a transaction of the creator with commands added by the given
+   * function
+   */
+  template <typename Builder>
+  shared_model::proto::Transaction makeTx(const std::string &creator,
+                                          Builder &&builder) {
+    return builder(TestTransactionBuilder()
+                       .creatorAccountId(creator)
+                       .createdTime(iroha::time::now())
+                       .quorum(1))
+        .build();
+  }
+
+  /**
+   * Create a transfer of the coin made by the source account
+   */
+  shared_model::proto::Transaction transfer(const std::string &src,
+                                            const std::string &dest) {
+    return makeTx(src, [&](auto builder) {
+      return builder.transferAsset(src, dest, "coin#test", "", "1.0");
+    });
+  }
+
+  /**
+   * Split the transactions into independent groups
+   */
+  Groups groups(const std::vector<shared_model::proto::Transaction> &txs) {
+    std::vector<ReadWriteSet> units;
+    for (const auto &tx : txs) {
+      units.push_back(readWriteSet(tx));
+    }
+    return independentGroups(units);
+  }
+};
+
+/**
+ * @given transfers between disjoint pairs of accounts
+ * @when transactions are split into groups
+ * @then each transaction forms its own group
+ */
+TEST_F(ConflictAnalysisTest, UnrelatedTransfersAreIndependent) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(transfer("a@test", "b@test"));
+  txs.push_back(transfer("c@test", "d@test"));
+  txs.push_back(transfer("e@test", "f@test"));
+
+  ASSERT_EQ(groups(txs), (Groups{{0}, {1}, {2}}));
+}
+
+/**
+ * @given transfers where the first and the last share an account
+ * @when transactions are split into groups
+ * @then transactions sharing the account are in one group in proposal order
+ */
+TEST_F(ConflictAnalysisTest, SharedAccountJoinsGroups) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(transfer("a@test", "b@test"));
+  txs.push_back(transfer("c@test", "d@test"));
+  txs.push_back(transfer("b@test", "e@test"));
+
+  ASSERT_EQ(groups(txs), (Groups{{0, 2}, {1}}));
+}
+
+/**
+ * @given creation of an asset followed by addition of its quantity
+ * @when transactions are split into groups
+ * @then the transactions are in one group
+ */
+TEST_F(ConflictAnalysisTest, CreatedAssetJoinsGroups) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(makeTx("admin@test", [](auto builder) {
+    return builder.createAsset("gold", "test", 2);
+  }));
+  txs.push_back(makeTx("user@test", [](auto builder) {
+    return builder.addAssetQuantity("gold#test", "1.00");
+  }));
+
+  ASSERT_EQ(groups(txs), (Groups{{0, 1}}));
+}
+
+/**
+ * @given transactions of the same creator which change other accounts
+ * @when transactions are split into groups
+ * @then reads of the creator do not join the groups
+ */
+TEST_F(ConflictAnalysisTest, SharedReadsAreIndependent) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(makeTx("admin@test", [](auto builder) {
+    return builder.setAccountQuorum("a@test", 2);
+  }));
+  txs.push_back(makeTx("admin@test", [](auto builder) {
+    return builder.setAccountQuorum("b@test", 2);
+  }));
+
+  ASSERT_EQ(groups(txs), (Groups{{0}, {1}}));
+}
@@ -30,6 +30,7 @@ using ::testing::ByRef;
 using ::testing::Eq;
 using ::testing::Return;
 using ::testing::ReturnArg;
+using ::testing::SizeIs;
 
 class SignaturesSubset : public testing::Test {
  public:
@@ -335,3 +336,60 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given validator with two threads @and two independent transactions
+ * @when statefully validating these transactions
+ * @then each transaction is validated on its own temporary wsv @and both are
+ * applied to the given wsv at once
+ */
+TEST_F(Validator, IndependentTxsValidatedConcurrently) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("doge@master")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .createAsset("doge", "coin", 1)
+                    .build());
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("cate@master")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .createAsset("cate", "coin", 1)
+                    .build());
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  auto worker = [] {
+    auto wsv = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+    EXPECT_CALL(*wsv, apply(_))
+        .WillOnce(Return(iroha::expected::Value<void>({})));
+    return iroha::expected::Result<
+        std::unique_ptr<iroha::ametsuchi::TemporaryWsv>,
+        std::string>(iroha::expected::makeValue(
+        std::unique_ptr<iroha::ametsuchi::TemporaryWsv>(std::move(wsv))));
+  };
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv())
+      .WillOnce(Return(ByMove(worker())))
+      .WillOnce(Return(ByMove(worker())));
+  EXPECT_CALL(*temp_wsv_mock, apply(_)).Times(0);
+  EXPECT_CALL(*temp_wsv_mock, applyValidated(SizeIs(2)))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(),
+      std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+      temporary_factory,
+      2);
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  ASSERT_EQ(
+      verified_proposal_and_errors->verified_proposal->transactions().size(),
+      2);
+  ASSERT_TRUE(verified_proposal_and_errors->rejected_transactions.empty());
+}
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/validators/validators.hpp"
@@ -50,3 +51,31 @@ TEST_F(ProtoBlockFactoryTest, UnsafeBlockCreation) {
   ASSERT_EQ(block->prevHash().hex(), prev_hash.hex());
   ASSERT_EQ(block->transactions(), txs);
 }
+
+/**
+ * @given block created by unsafeCreateBlock function
+ * @when the block is cloned and destroyed
+ * @then the block transport object is allocated in an arena
+ * @then transactions of the clone are still accessible
+ */
+TEST_F(ProtoBlockFactoryTest, UnsafeBlockInArena) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.emplace_back(iroha::protocol::Transaction{});
+
+  std::vector<shared_model::crypto::Hash> rejected_txs;
+
+  auto block = factory->unsafeCreateBlock(
+      1,
+      shared_model::crypto::Hash::fromHexString("123456"),
+      iroha::time::now(),
+      txs,
+      rejected_txs);
+  ASSERT_NE(
+      static_cast<proto::Block &>(*block).getTransport().GetArena(),
+      nullptr);
+
+  auto copy = clone(*block);
+  block.reset();
+
+  ASSERT_EQ(copy->transactions(), txs);
+}
@@ -73,3 +73,22 @@ TEST_F(ProposalFactoryTest, InvalidProposalTest) {
       },
       [](const ErrorOf<decltype(proposal)> &) { SUCCEED(); });
 }
+
+/**
+ * @given proposal factory and valid data
+ * @when proposal is created using unsafe method, cloned and destroyed
+ * @then the proposal transport object is allocated in an arena
+ * @then transactions of the clone are still accessible
+ */
+TEST_F(ProposalFactoryTest, UnsafeProposalInArena) {
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+  ASSERT_NE(
+      static_cast<proto::Proposal &>(*proposal).getTransport().GetArena(),
+      nullptr);
+
+  auto copy = clone(*proposal);
+  proposal.reset();
+
+  ASSERT_EQ(txs, copy->transactions());
+  ASSERT_EQ(height, copy->height());
+}
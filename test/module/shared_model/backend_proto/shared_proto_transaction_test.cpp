@@ -102,3 +102,47 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction whose blob was read
+ * @when a signature is added
+ * @then blob is serialized again @and payload and reduced hash are unchanged
+ */
+TEST(ProtoTransaction, AddSignatureUpdatesBlob) {
+  shared_model::proto::Transaction tx(generateEmptyTransaction());
+  auto blob = tx.blob();
+  auto payload = tx.payload();
+  auto reduced_hash = tx.reducedHash();
+
+  auto keypair =
+      shared_model::crypto::CryptoProviderEd25519Sha3::generateKeypair();
+  ASSERT_TRUE(tx.addSignature(
+      shared_model::crypto::CryptoSigner<>::sign(tx.payload(), keypair),
+      keypair.publicKey()));
+
+  ASSERT_NE(tx.blob(), blob);
+  ASSERT_EQ(tx.blob(),
+            shared_model::crypto::Blob(tx.getTransport().SerializeAsString()));
+  ASSERT_EQ(tx.payload(), payload);
+  ASSERT_EQ(tx.reducedHash(), reduced_hash);
+}
+
+/**
+ * @given transaction and a reference to its blob
+ * @when a signature is added
+ * @then the reference still points to the blob serialized before
+ */
+TEST(ProtoTransaction, BlobReferenceValidAfterAddSignature) {
+  shared_model::proto::Transaction tx(generateEmptyTransaction());
+  const auto &blob = tx.blob();
+  auto serialized = tx.getTransport().SerializeAsString();
+
+  auto keypair =
+      shared_model::crypto::CryptoProviderEd25519Sha3::generateKeypair();
+  ASSERT_TRUE(tx.addSignature(
+      shared_model::crypto::CryptoSigner<>::sign(tx.payload(), keypair),
+      keypair.publicKey()));
+
+  ASSERT_EQ(blob, shared_model::crypto::Blob(serialized));
+  ASSERT_NE(&tx.blob(), &blob);
+}
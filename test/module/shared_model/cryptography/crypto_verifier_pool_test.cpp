@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/crypto_provider/crypto_verifier_pool.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::crypto;
+
+class CryptoVerifierPoolTest : public ::testing::Test {
+ public:
+  /**
+   * Sign distinct blobs, replacing signatures at given indices with
+   * signatures of other data
+   */
+  void sign(size_t count, const std::vector<size_t> &wrong) {
+    for (size_t i = 0; i < count; ++i) {
+      sources.emplace_back("data " + std::to_string(i));
+      auto signed_source =
+          std::find(wrong.begin(), wrong.end(), i) == wrong.end()
+          ? sources.back()
+          : Blob("wrong data");
+      signatures.push_back(
+          DefaultCryptoAlgorithmType::sign(signed_source, keypair));
+    }
+    for (size_t i = 0; i < count; ++i) {
+      entries.push_back({signatures[i], sources[i], keypair.publicKey()});
+    }
+  }
+
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  std::vector<Blob> sources;
+  std::vector<Signed> signatures;
+  std::vector<VerificationEntry> entries;
+};
+
+/**
+ * @given signatures where some are made over other data
+ * @when the batch is verified
+ * @then indices of wrong signatures are returned
+ */
+TEST_F(CryptoVerifierPoolTest, BatchReportsWrongSignatures) {
+  sign(5, {1, 4});
+
+  ASSERT_EQ(CryptoVerifier<>::verifyBatch(entries),
+            (std::vector<size_t>{1, 4}));
+}
+
+/**
+ * @given signature of a wrong size
+ * @when the batch is verified
+ * @then the signature is reported as wrong
+ */
+TEST_F(CryptoVerifierPoolTest, BatchReportsMalformedSignature) {
+  sign(2, {});
+  Signed malformed("short");
+  entries.pop_back();
+  entries.push_back({malformed, sources[1], keypair.publicKey()});
+
+  ASSERT_EQ(CryptoVerifier<>::verifyBatch(entries), std::vector<size_t>{1});
+}
+
+/**
+ * @given pool of several threads @and a batch split into many chunks
+ * @when the batch is verified by the pool
+ * @then indices of wrong signatures from all chunks are returned in order
+ */
+TEST_F(CryptoVerifierPoolTest, PoolMergesChunks) {
+  sign(50, {0, 17, 49});
+  CryptoVerifierPool<> pool(3, 4);
+
+  ASSERT_EQ(pool.verify(entries), (std::vector<size_t>{0, 17, 49}));
+}
+
+/**
+ * @given pool without threads
+ * @when a batch is verified by the pool
+ * @then the batch is verified by the calling thread
+ */
+TEST_F(CryptoVerifierPoolTest, PoolWithoutThreads) {
+  sign(20, {3});
+  CryptoVerifierPool<> pool(0, 4);
+
+  ASSERT_EQ(pool.verify(entries), std::vector<size_t>{3});
+}
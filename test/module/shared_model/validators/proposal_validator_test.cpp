@@ -11,6 +11,7 @@
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "validators/default_validator.hpp"
+#include "validators/pooled_signatures_validator.hpp"
 
 using namespace shared_model::validation;
 
@@ -19,6 +20,19 @@ class ProposalValidatorTest : public ValidatorsTest {
   using BatchTypeAndCreatorPair =
       std::pair<shared_model::interface::types::BatchType, std::string>;
 
+  /**
+   * @param txs - transactions of the proposal
+   * @return proposal with the transactions
+   */
+  auto makeProposal(std::vector<shared_model::proto::Transaction> txs) {
+    return std::make_shared<shared_model::proto::Proposal>(
+        TestProposalBuilder()
+            .height(1)
+            .createdTime(txs.front().createdTime())
+            .transactions(txs)
+            .build());
+  }
+
   DefaultProposalValidator validator_;
 };
 
@@ -47,3 +61,43 @@ TEST_F(ProposalValidatorTest, IncompleteBatch) {
   auto answer = validator_.validate(*proposal);
   ASSERT_TRUE(answer);
 }
+
+/**
+ * @given a proposal with a complete batch, and the same proposal where one
+ * transaction has a signature of another transaction
+ * @when they are validated with signatures verified by a pool
+ * @then the answer for the correct proposal is the same as of the default
+ * validator @and only the transaction with the wrong signature is reported
+ */
+TEST_F(ProposalValidatorTest, PooledSignaturesVerified) {
+  PooledSignaturesValidator<shared_model::interface::Proposal,
+                            DefaultUnsignedProposalValidator>
+      pooled_validator(
+          std::make_shared<shared_model::crypto::CryptoVerifierPool<>>(2, 1));
+  auto txs = framework::batch::createBatchOneSignTransactions(
+      std::vector<BatchTypeAndCreatorPair>{
+          BatchTypeAndCreatorPair{
+              shared_model::interface::types::BatchType::ATOMIC, "a@domain"},
+          BatchTypeAndCreatorPair{
+              shared_model::interface::types::BatchType::ATOMIC, "b@domain"}});
+  std::vector<shared_model::proto::Transaction> proto_txs;
+  for (const auto &tx : txs) {
+    proto_txs.push_back(
+        *std::static_pointer_cast<shared_model::proto::Transaction>(tx));
+  }
+  auto proposal = makeProposal(proto_txs);
+  ASSERT_EQ(validator_.validate(*proposal).reason(),
+            pooled_validator.validate(*proposal).reason());
+
+  auto transport = proto_txs[1].getTransport();
+  *transport.mutable_signatures(0) = proto_txs[0].getTransport().signatures(0);
+  proto_txs.pop_back();
+  proto_txs.emplace_back(transport);
+  auto answer = pooled_validator.validate(*makeProposal(proto_txs));
+
+  ASSERT_TRUE(answer);
+  auto reason = answer.reason();
+  ASSERT_NE(reason.find("Wrong signature"), std::string::npos);
+  ASSERT_NE(reason.find(proto_txs[1].hash().hex()), std::string::npos);
+  ASSERT_EQ(reason.find(proto_txs[0].hash().hex()), std::string::npos);
+}